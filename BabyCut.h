@@ -0,0 +1,558 @@
+#ifndef BabyCut_h
+#define BabyCut_h
+
+// C++ Includes
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ROOT Includes
+#include "TBranch.h"
+#include "TLeaf.h"
+#include "TList.h"
+#include "TNamed.h"
+#include "TObjArray.h"
+#include "TString.h"
+#include "TTree.h"
+
+// A selection string in the TTree::Draw syntax ("num_mu_ssV5 && abs(eta) < 2.4 && ptj1 > 40"),
+// compiled once into a small stack program over the addresses of the variables
+// it uses.  Pass() then evaluates it for the current values of the variables,
+// with no lookups and no TTreeFormula.
+//
+// The expressions are numbers, variables, the C operators
+//     ||  &&  |  &  ==  !=  <  <=  >  >=  <<  >>  +  -  *  /  %  !  unary -
+// with the C precedence, parentheses and the functions abs, fabs, sqrt, min,
+// max (also as TMath::Abs, TMath::Sqrt, TMath::Min, TMath::Max).
+// An empty string passes everything, like an empty TCut.  A name which is not
+// a variable can be an alias (name -> expression), as in TTree::SetAlias.
+//
+// The variables are given as name -> (address, type), the type being the
+// ROOT leaf type code: F (Float_t), D (Double_t), I (Int_t), i (UInt_t),
+// S (Short_t), s (UShort_t), B (Char_t), b (UChar_t), O (Bool_t), L (Long64_t),
+// l (ULong64_t).
+
+struct BabyCutVariable
+{
+    const void* address;
+    char        type;
+};
+
+typedef std::map<std::string, BabyCutVariable> BabyCutVariables;
+typedef std::map<std::string, std::string> BabyCutAliases;
+
+class BabyCut
+{
+public:
+
+    BabyCut() : pos_(0), variables_(NULL), aliases_(NULL) {}
+
+    // throws std::invalid_argument for a syntax error or an unknown variable
+    BabyCut(const std::string& text, const BabyCutVariables& variables, const BabyCutAliases* aliases = NULL)
+        : text_ ( text )
+    {
+        pos_       = 0;
+        variables_ = &variables;
+        aliases_   = aliases;
+        SkipSpaces();
+        if (pos_ < text_.size())
+        {
+            ParseOr();
+            SkipSpaces();
+            if (pos_ < text_.size())
+                Fail("unexpected character");
+        }
+        variables_ = NULL;
+        aliases_   = NULL;
+
+        // stack depth of the program
+        int depth = 0, maxDepth = 0;
+        for (unsigned int iop = 0; iop < ops_.size(); iop++)
+        {
+            depth += (ops_[iop].code <= kVariable) ? 1 : (ops_[iop].code <= kSqrt ? 0 : -1);
+            maxDepth = std::max(maxDepth, depth);
+        }
+        stack_.resize(maxDepth);
+    }
+
+    const std::string& Text() const {return text_;}
+
+    // the variables the cut reads
+    const std::vector<std::string>& Names() const {return names_;}
+
+    bool Pass() const {return ops_.empty() || Eval() != 0;}
+
+    // value of the expression (1 or 0 for a selection)
+    double Eval() const
+    {
+        if (ops_.empty())
+            return 1;
+        double* top = &stack_[0] - 1;
+        for (std::vector<Op>::const_iterator op = ops_.begin(); op != ops_.end(); ++op)
+        {
+            switch (op->code)
+            {
+                case kConstant : *++top = op->constant;                   break;
+                case kVariable : *++top = Load(op->address, op->type);    break;
+                case kNegate   : *top = -*top;                            break;
+                case kNot      : *top = (*top == 0);                      break;
+                case kAbs      : *top = fabs(*top);                       break;
+                case kSqrt     : *top = sqrt(*top);                       break;
+                default:
+                {
+                    const double b = *top--;
+                    double& a = *top;
+                    switch (op->code)
+                    {
+                        case kAdd    : a = a + b;  break;
+                        case kSub    : a = a - b;  break;
+                        case kMul    : a = a * b;  break;
+                        case kDiv    : a = a / b;  break;
+                        case kMod    : a = (static_cast<Long64_t>(b) == 0) ? 0 : static_cast<double>(static_cast<Long64_t>(a) % static_cast<Long64_t>(b)); break;
+                        case kLess   : a = (a <  b); break;
+                        case kLessEq : a = (a <= b); break;
+                        case kMore   : a = (a >  b); break;
+                        case kMoreEq : a = (a >= b); break;
+                        case kEqual  : a = (a == b); break;
+                        case kNotEq  : a = (a != b); break;
+                        case kAnd    : a = (a != 0 && b != 0); break;
+                        case kOr     : a = (a != 0 || b != 0); break;
+                        case kBitAnd : a = static_cast<double>(static_cast<Long64_t>(a) &  static_cast<Long64_t>(b)); break;
+                        case kBitOr  : a = static_cast<double>(static_cast<Long64_t>(a) |  static_cast<Long64_t>(b)); break;
+                        case kShiftL : a = static_cast<double>(static_cast<Long64_t>(a) << static_cast<Long64_t>(b)); break;
+                        case kShiftR : a = static_cast<double>(static_cast<Long64_t>(a) >> static_cast<Long64_t>(b)); break;
+                        case kMin    : a = std::min(a, b); break;
+                        case kMax    : a = std::max(a, b); break;
+                    }
+                }
+            }
+        }
+        return *top;
+    }
+
+private:
+
+    // operands (push), unary operators, then binary operators
+    enum Code
+    {
+        kConstant, kVariable,
+        kNegate, kNot, kAbs, kSqrt,
+        kAdd, kSub, kMul, kDiv, kMod, kLess, kLessEq, kMore, kMoreEq, kEqual, kNotEq,
+        kAnd, kOr, kBitAnd, kBitOr, kShiftL, kShiftR, kMin, kMax
+    };
+
+    struct Op
+    {
+        int         code;
+        double      constant;
+        const void* address;
+        char        type;
+    };
+
+    static double Load(const void* address, char type)
+    {
+        switch (type)
+        {
+            case 'F': return *static_cast<const Float_t*  >(address);
+            case 'D': return *static_cast<const Double_t* >(address);
+            case 'I': return *static_cast<const Int_t*    >(address);
+            case 'i': return *static_cast<const UInt_t*   >(address);
+            case 'S': return *static_cast<const Short_t*  >(address);
+            case 's': return *static_cast<const UShort_t* >(address);
+            case 'B': return *static_cast<const Char_t*   >(address);
+            case 'b': return *static_cast<const UChar_t*  >(address);
+            case 'O': return *static_cast<const Bool_t*   >(address);
+            case 'L': return static_cast<double>(*static_cast<const Long64_t* >(address));
+            case 'l': return static_cast<double>(*static_cast<const ULong64_t*>(address));
+        }
+        return 0;
+    }
+
+    void Emit(int code, double constant = 0, const void* address = NULL, char type = 0)
+    {
+        Op op = {code, constant, address, type};
+        ops_.push_back(op);
+    }
+
+    void Fail(const std::string& what) const
+    {
+        throw std::invalid_argument(Form("BabyCut: %s at position %u of \"%s\"", what.c_str(), static_cast<unsigned int>(pos_), text_.c_str()));
+    }
+
+    void SkipSpaces()
+    {
+        while (pos_ < text_.size() && isspace(text_[pos_]))
+            ++pos_;
+    }
+
+    // the operator token at the current position (not consumed)
+    bool Peek(const char* token)
+    {
+        SkipSpaces();
+        return text_.compare(pos_, strlen(token), token) == 0;
+    }
+
+    bool Accept(const char* token)
+    {
+        if (!Peek(token))
+            return false;
+        pos_ += strlen(token);
+        return true;
+    }
+
+    void Expect(const char* token)
+    {
+        if (!Accept(token))
+            Fail(std::string("expected '") + token + "'");
+    }
+
+    // binary operator levels, lowest precedence first
+    void ParseOr()
+    {
+        ParseAnd();
+        while (Accept("||")) {ParseAnd(); Emit(kOr);}
+    }
+
+    void ParseAnd()
+    {
+        ParseBitOr();
+        while (Accept("&&")) {ParseBitOr(); Emit(kAnd);}
+    }
+
+    void ParseBitOr()
+    {
+        ParseBitAnd();
+        while (!Peek("||") && Accept("|")) {ParseBitAnd(); Emit(kBitOr);}
+    }
+
+    void ParseBitAnd()
+    {
+        ParseEquality();
+        while (!Peek("&&") && Accept("&")) {ParseEquality(); Emit(kBitAnd);}
+    }
+
+    void ParseEquality()
+    {
+        ParseRelation();
+        for (;;)
+        {
+            if      (Accept("==")) {ParseRelation(); Emit(kEqual);}
+            else if (Accept("!=")) {ParseRelation(); Emit(kNotEq);}
+            else break;
+        }
+    }
+
+    void ParseRelation()
+    {
+        ParseShift();
+        for (;;)
+        {
+            if      (Accept("<=")) {ParseShift(); Emit(kLessEq);}
+            else if (Accept(">=")) {ParseShift(); Emit(kMoreEq);}
+            else if (!Peek("<<") && Accept("<")) {ParseShift(); Emit(kLess);}
+            else if (!Peek(">>") && Accept(">")) {ParseShift(); Emit(kMore);}
+            else break;
+        }
+    }
+
+    void ParseShift()
+    {
+        ParseSum();
+        for (;;)
+        {
+            if      (Accept("<<")) {ParseSum(); Emit(kShiftL);}
+            else if (Accept(">>")) {ParseSum(); Emit(kShiftR);}
+            else break;
+        }
+    }
+
+    void ParseSum()
+    {
+        ParseProduct();
+        for (;;)
+        {
+            if      (Accept("+")) {ParseProduct(); Emit(kAdd);}
+            else if (Accept("-")) {ParseProduct(); Emit(kSub);}
+            else break;
+        }
+    }
+
+    void ParseProduct()
+    {
+        ParseUnary();
+        for (;;)
+        {
+            if      (Accept("*")) {ParseUnary(); Emit(kMul);}
+            else if (Accept("/")) {ParseUnary(); Emit(kDiv);}
+            else if (Accept("%")) {ParseUnary(); Emit(kMod);}
+            else break;
+        }
+    }
+
+    void ParseUnary()
+    {
+        if      (Accept("!")) {ParseUnary(); Emit(kNot);}
+        else if (Accept("-")) {ParseUnary(); Emit(kNegate);}
+        else if (Accept("+")) {ParseUnary();}
+        else ParsePrimary();
+    }
+
+    void ParsePrimary()
+    {
+        SkipSpaces();
+        if (pos_ >= text_.size())
+            Fail("unexpected end");
+
+        if (Accept("("))
+        {
+            ParseOr();
+            Expect(")");
+            return;
+        }
+
+        const char c = text_[pos_];
+        if (isdigit(c) || c == '.')
+        {
+            const char* begin = text_.c_str() + pos_;
+            char* end = NULL;
+            const double value = strtod(begin, &end);
+            if (end == begin)
+                Fail("bad number");
+            pos_ += (end - begin);
+            Emit(kConstant, value);
+            return;
+        }
+
+        if (!isalpha(c) && c != '_')
+            Fail("unexpected character");
+        const size_t begin = pos_;
+        while (pos_ < text_.size() && (isalnum(text_[pos_]) || text_[pos_] == '_' || text_[pos_] == ':'))
+            ++pos_;
+        const std::string name = text_.substr(begin, pos_ - begin);
+
+        if (Peek("("))
+        {
+            ParseFunction(name);
+            return;
+        }
+
+        BabyCutVariables::const_iterator it = variables_->find(name);
+        if (it == variables_->end())
+        {
+            ParseAlias(name);
+            return;
+        }
+        Emit(kVariable, 0, it->second.address, it->second.type);
+        if (std::find(names_.begin(), names_.end(), name) == names_.end())
+            names_.push_back(name);
+    }
+
+    // the expression of an alias, parsed in place of its name
+    void ParseAlias(const std::string& name)
+    {
+        BabyCutAliases::const_iterator alias = aliases_ ? aliases_->find(name) : BabyCutAliases::const_iterator();
+        if (!aliases_ || alias == aliases_->end())
+            Fail("unknown variable " + name);
+        if (std::find(aliasStack_.begin(), aliasStack_.end(), name) != aliasStack_.end())
+            Fail("recursive alias " + name);
+
+        const std::string text = text_;
+        const size_t pos = pos_;
+        aliasStack_.push_back(name);
+        text_ = alias->second;
+        pos_  = 0;
+        ParseOr();
+        SkipSpaces();
+        if (pos_ < text_.size())
+            Fail("unexpected character in alias " + name);
+        aliasStack_.pop_back();
+        text_ = text;
+        pos_  = pos;
+    }
+
+    void ParseFunction(const std::string& name)
+    {
+        Expect("(");
+        ParseOr();
+        if (name == "abs" || name == "fabs" || name == "TMath::Abs")
+            Emit(kAbs);
+        else if (name == "sqrt" || name == "TMath::Sqrt")
+            Emit(kSqrt);
+        else if (name == "min" || name == "TMath::Min" || name == "max" || name == "TMath::Max")
+        {
+            Expect(",");
+            ParseOr();
+            Emit((name == "min" || name == "TMath::Min") ? kMin : kMax);
+        }
+        else
+            Fail("unknown function " + name);
+        Expect(")");
+    }
+
+    std::string              text_;
+    std::vector<Op>          ops_;
+    std::vector<std::string> names_;
+    mutable std::vector<double> stack_;
+
+    // parser state
+    size_t                   pos_;
+    const BabyCutVariables*  variables_;
+    const BabyCutAliases*    aliases_;
+    std::vector<std::string> aliasStack_;
+};
+
+// The cuts of a baby tree or chain, compiled over its branches.
+//
+// Every scalar branch of the tree can be used, and its aliases (such as the
+// packed selection flags of myBabyMaker::SetPackSelections).  Get compiles a
+// cut the first time its text is asked for, and returns the same compiled cut
+// after that.  Only the branches read by the compiled cuts stay enabled in
+// the tree, so GetEntry reads just those:
+//
+//     TChain* chain = ...;
+//     BabyCutLibrary cuts(chain);
+//     const BabyCut& isNum = cuts.Get("num && abs(id)==13 && ptj1>15");
+//     const BabyCut& pt    = cuts.Get("pt");
+//     for (Long64_t i = 0; i < chain->GetEntries(); i++)
+//     {
+//         chain->GetEntry(i);
+//         if (isNum.Pass()) h->Fill(pt.Eval());
+//     }
+//
+// The branch addresses of the tree are set to the library, which must
+// outlive the loop.  Arrays, Sum$ and the other TTreeFormula extensions are
+// not supported: Get throws std::invalid_argument for them.
+
+class BabyCutLibrary
+{
+public:
+
+    explicit BabyCutLibrary(TTree* tree)
+        : tree_ ( tree )
+    {
+        // a chain has no tree before its first entry is loaded
+        if (!tree_->GetTree())
+            tree_->LoadTree(0);
+        TTree* current = tree_->GetTree();
+        if (!current)
+            throw std::invalid_argument(Form("BabyCutLibrary: %s has no entries", tree_->GetName()));
+
+        TObjArray* leaves = current->GetListOfLeaves();
+        storage_.resize(leaves->GetEntriesFast());
+        for (int ileaf = 0; ileaf < leaves->GetEntriesFast(); ileaf++)
+        {
+            TLeaf* leaf = static_cast<TLeaf*>(leaves->At(ileaf));
+            if (leaf->GetLen() != 1 || leaf->GetLeafCount() || leaf->GetBranch()->GetNleaves() != 1)
+                continue;
+            const char type = LeafType(leaf->GetTypeName());
+            if (!type)
+                continue;
+            BabyCutVariable variable = {&storage_[ileaf], type};
+            variables_[leaf->GetBranch()->GetName()] = variable;
+        }
+
+        AddAliases(current->GetListOfAliases());
+        if (current != tree_)
+            AddAliases(tree_->GetListOfAliases());
+    }
+
+    // the tree no longer reads into the library, and its branches are enabled as before
+    ~BabyCutLibrary()
+    {
+        for (unsigned int ibranch = 0; ibranch < branches_.size(); ibranch++)
+        {
+            TBranch* branch = tree_->GetBranch(branches_[ibranch].c_str());
+            if (branch)
+                tree_->ResetBranchAddress(branch);
+        }
+        for (unsigned int ibranch = 0; ibranch < status_.size(); ibranch++)
+            tree_->SetBranchStatus(status_[ibranch].first.c_str(), status_[ibranch].second);
+    }
+
+    // the compiled cut of text (an empty text passes everything)
+    const BabyCut& Get(const char* text)
+    {
+        const std::string key = text ? text : "";
+        std::map<std::string, BabyCut>::iterator it = cuts_.find(key);
+        if (it != cuts_.end())
+            return it->second;
+
+        it = cuts_.insert(std::make_pair(key, BabyCut(key, variables_, &aliases_))).first;
+        const std::vector<std::string>& names = it->second.Names();
+        for (unsigned int iname = 0; iname < names.size(); iname++)
+            Read(names[iname]);
+        return it->second;
+    }
+
+    // the branches read
+    const std::vector<std::string>& Branches() const {return branches_;}
+
+private:
+
+    // the branch addresses point into storage_
+    BabyCutLibrary(const BabyCutLibrary&);
+    BabyCutLibrary& operator=(const BabyCutLibrary&);
+
+    static char LeafType(const std::string& type)
+    {
+        if (type == "Float_t"  ) return 'F';
+        if (type == "Double_t" ) return 'D';
+        if (type == "Int_t"    ) return 'I';
+        if (type == "UInt_t"   ) return 'i';
+        if (type == "Short_t"  ) return 'S';
+        if (type == "UShort_t" ) return 's';
+        if (type == "Char_t"   ) return 'B';
+        if (type == "UChar_t"  ) return 'b';
+        if (type == "Bool_t"   ) return 'O';
+        if (type == "Long64_t" ) return 'L';
+        if (type == "ULong64_t") return 'l';
+        return 0;
+    }
+
+    void AddAliases(TList* aliases)
+    {
+        if (!aliases)
+            return;
+        for (int ialias = 0; ialias < aliases->GetSize(); ialias++)
+        {
+            const TNamed* alias = static_cast<const TNamed*>(aliases->At(ialias));
+            aliases_[alias->GetName()] = alias->GetTitle();
+        }
+    }
+
+    // enable a branch and read it into the library
+    void Read(const std::string& branch)
+    {
+        if (std::find(branches_.begin(), branches_.end(), branch) != branches_.end())
+            return;
+        if (branches_.empty())
+        {
+            TObjArray* all = tree_->GetListOfBranches();
+            for (int ibranch = 0; ibranch < all->GetEntriesFast(); ibranch++)
+            {
+                const char* name = all->At(ibranch)->GetName();
+                status_.push_back(std::make_pair(std::string(name), tree_->GetBranchStatus(name) != 0));
+            }
+            tree_->SetBranchStatus("*", 0);
+        }
+        branches_.push_back(branch);
+        tree_->SetBranchStatus(branch.c_str(), 1);
+        tree_->SetBranchAddress(branch.c_str(), const_cast<void*>(variables_[branch].address));
+    }
+
+    TTree*                         tree_;
+    std::vector<Long64_t>          storage_;    // one 8 byte slot per leaf, never resized
+    BabyCutVariables               variables_;
+    BabyCutAliases                 aliases_;
+    std::map<std::string, BabyCut> cuts_;
+    std::vector<std::string>       branches_;
+    std::vector<std::pair<std::string, bool> > status_;    // of the branches before the first Read
+};
+
+#endif
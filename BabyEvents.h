@@ -0,0 +1,107 @@
+#ifndef BabyEvents_h
+#define BabyEvents_h
+
+// C++ Includes
+#include <stdexcept>
+
+// ROOT Includes
+#include "TChain.h"
+#include "TDirectory.h"
+#include "TLeaf.h"
+#include "TString.h"
+#include "TTree.h"
+
+// Two-level layout of the baby (myBabyMaker::SetSplitEvents): the event
+// quantities (run, ls, evt, weight, pileup, nvtxs, pfmet, rho, ...) are
+// written once per event in the tree "events" instead of once per lepton
+// row, and the lepton tree "tree" has the entry of its event in evt_idx.
+//
+// With TTree::Draw on a single file, the events tree is a friend indexed
+// on evt_idx, so the cut strings keep working unchanged:
+//
+//     TTree* tree = (TTree*)file->Get("tree");
+//     baby_events::AttachEvents(tree);
+//     tree->Draw("pt", "pfmet < 20 && num_el_ssV7");
+//
+// In a looper over a chain, read the event of each row with BabyEventJoin;
+// it is read once for all the rows of the event:
+//
+//     TChain leptons("tree"), events("events");
+//     leptons.Add("baby*.root");
+//     events.Add("baby*.root");
+//     BabyEventJoin join(&leptons, &events);
+//     for (Long64_t i = 0; i < leptons.GetEntries(); i++)
+//     {
+//         leptons.GetEntry(i);
+//         join.GetEntry();
+//         ...
+//     }
+
+namespace baby_events
+{
+    const char* const kEventTree = "events";
+    const char* const kEventIndex = "evt_idx";
+
+    // make the events of the file of leptons a friend of it (NULL if the file is not split)
+    inline TTree* AttachEvents(TTree* leptons)
+    {
+        TDirectory* dir = leptons->GetDirectory();
+        TTree* events = dir ? dynamic_cast<TTree*>(dir->Get(kEventTree)) : NULL;
+        if (events)
+            leptons->AddFriend(events);
+        return events;
+    }
+}
+
+class BabyEventJoin
+{
+public:
+
+    // leptons and events: chains of "tree" and "events" over the same files
+    BabyEventJoin(TChain* leptons, TChain* events)
+        : leptons_    ( leptons )
+        , events_     ( events  )
+        , leaf_       ( NULL    )
+        , treeNumber_ ( -1      )
+        , lastEntry_  ( -1      )
+    {
+        if (leptons_->GetNtrees() != events_->GetNtrees())
+        {
+            throw std::invalid_argument(Form("BabyEventJoin: %d lepton and %d event files", leptons_->GetNtrees(), events_->GetNtrees()));
+        }
+        // fills the entry offsets of the files
+        events_->GetEntries();
+    }
+
+    // read the event of the current lepton row (after leptons->GetEntry);
+    // returns the bytes read, 0 if it is the event of the previous row
+    Int_t GetEntry()
+    {
+        if (leptons_->GetTreeNumber() != treeNumber_)
+        {
+            treeNumber_ = leptons_->GetTreeNumber();
+            leaf_ = leptons_->GetLeaf(baby_events::kEventIndex);
+            if (!leaf_)
+            {
+                throw std::invalid_argument(Form("BabyEventJoin: no %s in %s", baby_events::kEventIndex, leptons_->GetCurrentFile()->GetName()));
+            }
+        }
+        const Long64_t entry = events_->GetTreeOffset()[treeNumber_] + static_cast<Long64_t>(leaf_->GetValue());
+        if (entry == lastEntry_)
+            return 0;
+        lastEntry_ = entry;
+        return events_->GetEntry(entry);
+    }
+
+    Long64_t EventEntry() const {return lastEntry_;}
+
+private:
+
+    TChain*  leptons_;
+    TChain*  events_;
+    TLeaf*   leaf_;        // evt_idx of the current lepton file
+    Int_t    treeNumber_;
+    Long64_t lastEntry_;
+};
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef BabyMetadata_h
+#define BabyMetadata_h
+
+// C++ Includes
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ROOT Includes
+#include "TDirectory.h"
+#include "TFile.h"
+#include "TTree.h"
+#include "TObjArray.h"
+#include "TObjString.h"
+#include "TString.h"
+
+// The dataset and the input file of the baby rows are stored as indices
+// (branches dataset_idx and filename_idx) into tables of names written once
+// in each baby file, as TObjArrays of TObjStrings under the keys below.
+//
+// To get the names back in a looper:
+//
+//     BabyMetadata metadata;
+//     ...
+//     chain->GetEntry(i);
+//     cout << metadata.Dataset(chain, dataset_idx) << " " << metadata.Filename(chain, filename_idx) << endl;
+//
+// The indices are only meaningful within their file: with a TChain the
+// tables of the file of the current entry are used.
+//
+// The packed selection flags (myBabyMaker::SetPackSelections) are tested the
+// same way, the bit of each flag is in the table <word>_bits:
+//
+//     const ULong64_t ssNum = metadata.SelectionMask(chain, "selections2012", "num_el_ssV7 v1_el_ssV7");
+//     if (BabyMetadata::AllOf(selections2012, ssNum)) ...
+//     chain->Draw("pt", metadata.SelectionCut(chain, "selections2012", "num_el_ssV7 v1_el_ssV7"));
+//
+// The flag names also work as aliases in the cut strings (num_el_ssV7 && v1_el_ssV7).
+//
+// With the compact trigger block, the trigger of trig_id[i] is Trigger(chain, trig_id[i]),
+// e.g. in a cut: Form("Sum$(trig_id==%d && trig_match==2)>0", metadata.TriggerId(chain, "mu8_vstar")).
+
+namespace baby_metadata
+{
+    const char* const kDatasets  = "datasets";
+    const char* const kFilenames = "filenames";
+    const char* const kTriggers  = "triggers";
+
+    // "<branch> <max abs error> <max rel error>" of the reduced precision floats
+    const char* const kQuantizationErrors = "quantization_errors";
+
+    // names stored under key in dir (empty if there are none)
+    inline std::vector<std::string> ReadNames(TDirectory* dir, const char* key)
+    {
+        std::vector<std::string> names;
+        TObjArray* array = dir ? dynamic_cast<TObjArray*>(dir->Get(key)) : NULL;
+        if (array)
+        {
+            for (int i = 0; i < array->GetEntriesFast(); i++)
+                names.push_back(static_cast<TObjString*>(array->At(i))->GetString().Data());
+            array->SetOwner(true);
+            delete array;
+        }
+        return names;
+    }
+
+    inline void WriteNames(TDirectory* dir, const char* key, const std::vector<std::string>& names)
+    {
+        TObjArray array(names.size());
+        array.SetOwner(true);
+        for (unsigned int i = 0; i < names.size(); i++)
+            array.Add(new TObjString(names[i].c_str()));
+        dir->WriteTObject(&array, key, "Overwrite");
+    }
+}
+
+class BabyMetadata
+{
+public:
+
+    BabyMetadata() {}
+
+    const char* Dataset (TTree* tree, int idx) {return Name(Table(tree, baby_metadata::kDatasets ), idx);}
+    const char* Filename(TTree* tree, int idx) {return Name(Table(tree, baby_metadata::kFilenames), idx);}
+
+    // compact trigger block (myBabyMaker::SetCompactTriggers): name of a trig_id,
+    // and trig_id of a trigger name such as "ele8_CaloIdL_CaloIsoVL_vstar" (-1 if absent)
+    const char* Trigger(TTree* tree, int id) {return Name(Table(tree, baby_metadata::kTriggers), id);}
+    int TriggerId(TTree* tree, const char* name)
+    {
+        const std::vector<std::string>& triggers = Table(tree, baby_metadata::kTriggers);
+        const std::vector<std::string>::const_iterator it = std::find(triggers.begin(), triggers.end(), name);
+        return (it == triggers.end()) ? -1 : (it - triggers.begin());
+    }
+
+    // Mask of the selection flags in names (separated by spaces or commas) in the
+    // bit word branch word ("selections2012" or "selections2011") of a baby made
+    // with myBabyMaker::SetPackSelections.  Throws if a flag is not in the word.
+    ULong64_t SelectionMask(TTree* tree, const char* word, const char* names)
+    {
+        const std::vector<std::string>& bits = Table(tree, Form("%s_bits", word));
+        ULong64_t mask = 0;
+        TString flags(names);
+        flags.ReplaceAll(",", " ");
+        TObjArray* tokens = flags.Tokenize(" ");
+        for (int i = 0; i < tokens->GetEntriesFast(); i++)
+        {
+            const std::string flag = static_cast<TObjString*>(tokens->At(i))->GetString().Data();
+            const std::vector<std::string>::const_iterator it = std::find(bits.begin(), bits.end(), flag);
+            if (it == bits.end())
+            {
+                delete tokens;
+                throw std::invalid_argument(Form("BabyMetadata: no selection flag %s in %s", flag.c_str(), word));
+            }
+            mask |= (1ULL << (it - bits.begin()));
+        }
+        delete tokens;
+        return mask;
+    }
+
+    // cut string passing the rows with all the flags in names, for TTree::Draw
+    TString SelectionCut(TTree* tree, const char* word, const char* names)
+    {
+        const ULong64_t mask = SelectionMask(tree, word, names);
+        return Form("(%s&%llu)==%llu", word, mask, mask);
+    }
+
+    // predicates for compiled loopers: one load of the word, one AND for all the flags
+    static bool AllOf(ULong64_t bits, ULong64_t mask) {return (bits & mask) == mask;}
+    static bool AnyOf(ULong64_t bits, ULong64_t mask) {return (bits & mask) != 0;}
+
+private:
+
+    static const char* Name(const std::vector<std::string>& names, int idx)
+    {
+        if (idx < 0 || idx >= static_cast<int>(names.size()))
+            return "";
+        return names[idx].c_str();
+    }
+
+    // table key of the current file of tree (read once per file)
+    const std::vector<std::string>& Table(TTree* tree, const std::string& key)
+    {
+        TFile* file = tree->GetCurrentFile();
+        if (file && fileName_ != file->GetName())
+        {
+            fileName_ = file->GetName();
+            tables_.clear();
+        }
+        std::map<std::string, std::vector<std::string> >::iterator it = tables_.find(key);
+        if (it == tables_.end())
+            it = tables_.insert(std::make_pair(key, baby_metadata::ReadNames(file, key.c_str()))).first;
+        return it->second;
+    }
+
+    // tables of the last file read
+    std::string fileName_;
+    std::map<std::string, std::vector<std::string> > tables_;
+};
+
+#endif
@@ -0,0 +1,347 @@
+#include "DuplicateEventFilter.h"
+
+// C++ Includes
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+// ROOT Includes
+#include "TString.h"
+
+namespace
+{
+    // fibonacci hashing: the top nBits bits of the product
+    inline unsigned int HashEvent(unsigned int event, unsigned char nBits)
+    {
+        return static_cast<unsigned int>(event * 2654435769u) >> (32 - nBits);
+    }
+
+    inline unsigned int HashLumi(unsigned long long key, unsigned char nBits)
+    {
+        return static_cast<unsigned int>((key * 0x9E3779B97F4A7C15ULL) >> (64 - nBits));
+    }
+
+    // most recently used lumi tables last
+    struct OlderThan
+    {
+        OlderThan(const std::vector<unsigned long>& lastUsed) : lastUsed_(lastUsed) {}
+        bool operator() (unsigned int a, unsigned int b) const {return lastUsed_[a] < lastUsed_[b];}
+        const std::vector<unsigned long>& lastUsed_;
+    };
+
+    const unsigned char kMinEventBits = 4;
+    const unsigned char kMinLumiBits  = 8;
+}
+
+const unsigned int DuplicateEventFilter::kEmpty;
+
+DuplicateEventFilter::DuplicateEventFilter()
+    : lumiIndexBits_  ( 0    )
+    , nEvents_        ( 0    )
+    , useCounter_     ( 0    )
+    , lastKey_        ( 0    )
+    , lastIndex_      ( kEmpty )
+    , tableBytes_     ( 0    )
+    , spillFile_      ( NULL )
+    , maxMemoryBytes_ ( 0    )
+    , spillAtBytes_   ( 0    )
+    , warnedMemory_   ( false )
+    , nSpills_        ( 0    )
+    , nReloads_       ( 0    )
+{
+}
+
+DuplicateEventFilter::~DuplicateEventFilter()
+{
+    SetSpillFile("", 0);
+}
+
+void DuplicateEventFilter::Clear()
+{
+    std::vector<LumiSlot>().swap(lumiIndex_);
+    std::vector<LumiTable>().swap(lumis_);
+    lumiIndexBits_ = 0;
+    nEvents_       = 0;
+    useCounter_    = 0;
+    lastKey_       = 0;
+    lastIndex_     = kEmpty;
+    tableBytes_    = 0;
+    spillAtBytes_  = maxMemoryBytes_;
+    warnedMemory_  = false;
+    nSpills_       = 0;
+    nReloads_      = 0;
+
+    // start over with an empty spill file
+    if (spillFile_)
+    {
+        SetSpillFile(std::string(spillFileName_), maxMemoryBytes_ / (1024. * 1024.));
+    }
+}
+
+void DuplicateEventFilter::SetSpillFile(const std::string& fileName, float maxMemoryMB)
+{
+    if (spillFile_)
+    {
+        fclose(spillFile_);
+        remove(spillFileName_.c_str());
+        spillFile_ = NULL;
+    }
+    spillFileName_  = fileName;
+    maxMemoryBytes_ = 0;
+    spillAtBytes_   = 0;
+    if (fileName.empty())
+        return;
+
+    for (unsigned int i = 0; i < lumis_.size(); i++)
+    {
+        if (lumis_[i].spilled)
+            throw std::logic_error("[FR baby maker]: DuplicateEventFilter - cannot change the spill file while events are spilled");
+    }
+
+    spillFile_ = fopen(fileName.c_str(), "w+b");
+    if (!spillFile_)
+    {
+        throw std::runtime_error(Form("[FR baby maker]: DuplicateEventFilter - could not open spill file %s", fileName.c_str()));
+    }
+    maxMemoryBytes_ = static_cast<size_t>(maxMemoryMB * 1024. * 1024.);
+    spillAtBytes_   = maxMemoryBytes_;
+}
+
+size_t DuplicateEventFilter::MemoryUsage() const
+{
+    return tableBytes_
+        + lumiIndex_.capacity() * sizeof(LumiSlot)
+        + lumis_.capacity()     * sizeof(LumiTable);
+}
+
+void DuplicateEventFilter::PrintSummary(std::ostream& out) const
+{
+    out << Form("duplicate filter: %lu events in %u lumi sections, %.1f MB", nEvents_, NumLumis(), MemoryUsage() / (1024. * 1024.));
+    if (spillFile_)
+    {
+        out << Form(" (%lu lumi sections spilled to %s, %lu read back)", nSpills_, spillFileName_.c_str(), nReloads_);
+    }
+    out << std::endl;
+}
+
+bool DuplicateEventFilter::IsDuplicate(unsigned int run, unsigned int lumi, unsigned int event)
+{
+    LumiTable& table = FindLumi(run, lumi);
+    if (table.spilled)
+        Reload(table);
+
+    if (!Insert(table, event))
+        return true;
+
+    ++nEvents_;
+    if (maxMemoryBytes_ > 0 && MemoryUsage() > spillAtBytes_)
+        Spill();
+    return false;
+}
+
+// lumi table for (run, lumi), created if needed
+DuplicateEventFilter::LumiTable& DuplicateEventFilter::FindLumi(unsigned int run, unsigned int lumi)
+{
+    const unsigned long long key = (static_cast<unsigned long long>(run) << 32) | lumi;
+
+    // consecutive events are mostly from the same lumi
+    if (lastIndex_ != kEmpty && key == lastKey_)
+    {
+        LumiTable& table = lumis_[lastIndex_];
+        table.lastUsed = ++useCounter_;
+        return table;
+    }
+
+    if (2 * (lumis_.size() + 1) > lumiIndex_.size())
+        GrowLumiIndex();
+
+    const unsigned int mask = lumiIndex_.size() - 1;
+    unsigned int slot = HashLumi(key, lumiIndexBits_);
+    while (lumiIndex_[slot].index != kEmpty && lumiIndex_[slot].key != key)
+        slot = (slot + 1) & mask;
+
+    if (lumiIndex_[slot].index == kEmpty)
+    {
+        LumiTable table;
+        table.nEvents       = 0;
+        table.nBits         = 0;
+        table.hasEmptyValue = false;
+        table.spilled       = false;
+        table.spillOffset   = 0;
+        table.spillCapacity = 0;
+        table.lastUsed      = 0;
+        lumis_.push_back(table);
+        Rehash(lumis_.back(), kMinEventBits);
+
+        lumiIndex_[slot].key   = key;
+        lumiIndex_[slot].index = lumis_.size() - 1;
+    }
+
+    lastKey_   = key;
+    lastIndex_ = lumiIndex_[slot].index;
+
+    LumiTable& table = lumis_[lastIndex_];
+    table.lastUsed = ++useCounter_;
+    return table;
+}
+
+void DuplicateEventFilter::GrowLumiIndex()
+{
+    const unsigned char nBits = std::max(kMinLumiBits, static_cast<unsigned char>(lumiIndexBits_ + 1));
+    LumiSlot empty = {0, kEmpty};
+    std::vector<LumiSlot> old(1u << nBits, empty);
+    old.swap(lumiIndex_);
+    lumiIndexBits_ = nBits;
+
+    const unsigned int mask = lumiIndex_.size() - 1;
+    for (unsigned int i = 0; i < old.size(); i++)
+    {
+        if (old[i].index == kEmpty)
+            continue;
+        unsigned int slot = HashLumi(old[i].key, lumiIndexBits_);
+        while (lumiIndex_[slot].index != kEmpty)
+            slot = (slot + 1) & mask;
+        lumiIndex_[slot] = old[i];
+    }
+}
+
+// record event in table: false if it was already there
+bool DuplicateEventFilter::Insert(LumiTable& table, unsigned int event)
+{
+    // the empty slot marker is a valid event number
+    if (event == kEmpty)
+    {
+        if (table.hasEmptyValue)
+            return false;
+        table.hasEmptyValue = true;
+        ++table.nEvents;
+        return true;
+    }
+
+    const unsigned int mask = table.slots.size() - 1;
+    unsigned int slot = HashEvent(event, table.nBits);
+    while (table.slots[slot] != kEmpty)
+    {
+        if (table.slots[slot] == event)
+            return false;
+        slot = (slot + 1) & mask;
+    }
+
+    // keep the table at most half full
+    if (2 * (table.nEvents + 1) > table.slots.size())
+    {
+        Rehash(table, table.nBits + 1);
+        Place(table, event);
+    }
+    else
+    {
+        table.slots[slot] = event;
+    }
+    ++table.nEvents;
+    return true;
+}
+
+// put event in the first free slot (the event is known not to be in the table)
+void DuplicateEventFilter::Place(LumiTable& table, unsigned int event)
+{
+    const unsigned int mask = table.slots.size() - 1;
+    unsigned int slot = HashEvent(event, table.nBits);
+    while (table.slots[slot] != kEmpty)
+        slot = (slot + 1) & mask;
+    table.slots[slot] = event;
+}
+
+void DuplicateEventFilter::Rehash(LumiTable& table, unsigned char nBits)
+{
+    std::vector<unsigned int> old(1u << nBits, kEmpty);
+    old.swap(table.slots);
+    table.nBits = nBits;
+    tableBytes_ += table.slots.capacity() * sizeof(unsigned int);
+    tableBytes_ -= old.capacity() * sizeof(unsigned int);
+
+    for (unsigned int i = 0; i < old.size(); i++)
+    {
+        if (old[i] != kEmpty)
+            Place(table, old[i]);
+    }
+}
+
+// write the least recently used lumi tables to the spill file until
+// the memory use is down to half of the limit
+// (the lumi index and the current table stay in memory, so when they alone
+// take more than that the next spill waits until the memory use grew by half)
+void DuplicateEventFilter::Spill()
+{
+    std::vector<unsigned int> resident;
+    std::vector<unsigned long> lastUsed(lumis_.size());
+    for (unsigned int i = 0; i < lumis_.size(); i++)
+    {
+        lastUsed[i] = lumis_[i].lastUsed;
+        if (!lumis_[i].spilled && i != lastIndex_)
+            resident.push_back(i);
+    }
+    std::sort(resident.begin(), resident.end(), OlderThan(lastUsed));
+
+    std::vector<unsigned int> events;
+    for (unsigned int i = 0; i < resident.size() && MemoryUsage() > maxMemoryBytes_ / 2; i++)
+    {
+        LumiTable& table = lumis_[resident[i]];
+
+        events.clear();
+        for (unsigned int islot = 0; islot < table.slots.size(); islot++)
+        {
+            if (table.slots[islot] != kEmpty)
+                events.push_back(table.slots[islot]);
+        }
+
+        // a reloaded table goes back to its old block if it still fits, otherwise
+        // it is appended with room to grow (the old block is left behind)
+        if (events.size() > table.spillCapacity)
+        {
+            if (fseeko(spillFile_, 0, SEEK_END) != 0)
+                throw std::runtime_error(Form("[FR baby maker]: DuplicateEventFilter - could not seek in spill file %s", spillFileName_.c_str()));
+            table.spillOffset   = ftello(spillFile_);
+            table.spillCapacity = (table.spillCapacity > 0) ? 2 * events.size() : events.size();
+            events.resize(table.spillCapacity, kEmpty);
+        }
+        else if (fseeko(spillFile_, table.spillOffset, SEEK_SET) != 0)
+        {
+            throw std::runtime_error(Form("[FR baby maker]: DuplicateEventFilter - could not seek in spill file %s", spillFileName_.c_str()));
+        }
+        if (!events.empty() && fwrite(&events[0], sizeof(unsigned int), events.size(), spillFile_) != events.size())
+            throw std::runtime_error(Form("[FR baby maker]: DuplicateEventFilter - could not write spill file %s", spillFileName_.c_str()));
+
+        tableBytes_ -= table.slots.capacity() * sizeof(unsigned int);
+        std::vector<unsigned int>().swap(table.slots);
+        table.spilled = true;
+        ++nSpills_;
+    }
+
+    const size_t memoryUsage = MemoryUsage();
+    spillAtBytes_ = std::max(maxMemoryBytes_, memoryUsage + memoryUsage / 2);
+    if (memoryUsage > maxMemoryBytes_ / 2 && !warnedMemory_)
+    {
+        std::cout << Form("[FR baby maker]: DuplicateEventFilter - the lumi index of %u lumi sections and the current lumi take %.1f MB, over half of the %.1f MB limit", NumLumis(), memoryUsage / (1024. * 1024.), maxMemoryBytes_ / (1024. * 1024.)) << std::endl;
+        warnedMemory_ = true;
+    }
+}
+
+// read the events of a spilled lumi table back
+void DuplicateEventFilter::Reload(LumiTable& table)
+{
+    const unsigned int nStored = table.nEvents - (table.hasEmptyValue ? 1 : 0);
+    std::vector<unsigned int> events(nStored);
+    if (fflush(spillFile_) != 0 || fseeko(spillFile_, table.spillOffset, SEEK_SET) != 0)
+        throw std::runtime_error(Form("[FR baby maker]: DuplicateEventFilter - could not seek in spill file %s", spillFileName_.c_str()));
+    if (nStored > 0 && fread(&events[0], sizeof(unsigned int), nStored, spillFile_) != nStored)
+        throw std::runtime_error(Form("[FR baby maker]: DuplicateEventFilter - could not read spill file %s", spillFileName_.c_str()));
+
+    unsigned char nBits = kMinEventBits;
+    while ((1u << nBits) < 2 * (nStored + 1))
+        ++nBits;
+    Rehash(table, nBits);
+    for (unsigned int i = 0; i < events.size(); i++)
+        Place(table, events[i]);
+    table.spilled = false;
+    ++nReloads_;
+}
@@ -0,0 +1,97 @@
+#ifndef DuplicateEventFilter_h
+#define DuplicateEventFilter_h
+
+// C++ Includes
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <ostream>
+
+// Duplicate event detection for data.
+//
+// The events are kept per (run, lumi) in flat open-addressing hash tables of
+// 32 bit event numbers, and the (run, lumi) tables are found through a flat
+// hash as well.  This takes ~8 bytes per event instead of the ~48 bytes per
+// node of a std::set<DorkyEventIdentifier>, and the lookups do not chase pointers.
+//
+// Optionally, when the memory use goes over a limit, the least recently used
+// lumi tables are written to a spill file and read back if they are needed again.
+// (the data are mostly ordered by run and lumi, so this rarely happens).
+class DuplicateEventFilter
+{
+public:
+
+    DuplicateEventFilter();
+    ~DuplicateEventFilter();
+
+    // true if the event was already seen, otherwise the event is recorded
+    bool IsDuplicate(unsigned int run, unsigned int lumi, unsigned int event);
+
+    // forget all the events (the spill settings are kept)
+    void Clear();
+
+    // spill the lumi tables to fileName when the memory use goes over maxMemoryMB
+    // (an empty fileName turns the spill off)
+    void SetSpillFile(const std::string& fileName, float maxMemoryMB);
+
+    // bytes of memory used by the tables
+    size_t MemoryUsage() const;
+
+    unsigned long NumEvents() const {return nEvents_;}
+    unsigned int NumLumis() const {return lumis_.size();}
+
+    void PrintSummary(std::ostream& out) const;
+
+private:
+
+    // events of a single (run, lumi)
+    struct LumiTable
+    {
+        std::vector<unsigned int> slots;  // empty slots hold kEmpty
+        unsigned int  nEvents;
+        unsigned char nBits;              // slots.size() == 1 << nBits
+        bool          hasEmptyValue;      // event number kEmpty was seen
+        bool          spilled;            // the events are in the spill file
+        long long     spillOffset;
+        unsigned int  spillCapacity;      // events the block at spillOffset holds (0: no block)
+        unsigned long lastUsed;
+    };
+
+    // (run, lumi) -> index in lumis_
+    struct LumiSlot
+    {
+        unsigned long long key;
+        unsigned int       index;         // kEmpty for an empty slot
+    };
+
+    static const unsigned int kEmpty = 0xFFFFFFFF;
+
+    LumiTable& FindLumi(unsigned int run, unsigned int lumi);
+    bool Insert(LumiTable& table, unsigned int event);
+    static void Place(LumiTable& table, unsigned int event);
+    void Rehash(LumiTable& table, unsigned char nBits);
+    void GrowLumiIndex();
+
+    void Spill();
+    void Reload(LumiTable& table);
+
+    std::vector<LumiSlot>  lumiIndex_;
+    unsigned char          lumiIndexBits_;
+    std::vector<LumiTable> lumis_;
+    unsigned long          nEvents_;
+    unsigned long          useCounter_;
+    unsigned long long     lastKey_;      // (run, lumi) of the previous event
+    unsigned int           lastIndex_;
+    size_t                 tableBytes_;
+
+    // spill
+    std::string   spillFileName_;
+    FILE*         spillFile_;
+    size_t        maxMemoryBytes_;
+    size_t        spillAtBytes_;      // memory use that triggers the next spill
+    bool          warnedMemory_;
+    unsigned long nSpills_;
+    unsigned long nReloads_;
+};
+
+#endif
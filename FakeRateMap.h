@@ -0,0 +1,197 @@
+#ifndef FakeRateMap_h
+#define FakeRateMap_h
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+// ROOT Includes
+#include "TAxis.h"
+#include "TH2.h"
+#include "TString.h"
+
+// A fake rate histogram (pt vs |eta|, as made by eff2 or FakeRateFiller)
+// turned into flat tables for the prediction loops:
+//
+//     FakeRateMap map(muFR15u);
+//     for (...)
+//         if (isDenNotNum) predicted += map.Weight(eta, pt);
+//
+// For each bin it stores the fake rate FR, the weight FR/(1-FR) of a lepton
+// passing the denominator but not the numerator, and their errors (the
+// weight error is the FR error times 1/(1-FR)^2).  A bin with FR >= 1 has a
+// weight of 0, as the histogram division gave.
+//
+// The values outside the histogram are clamped to the first or last bin, so
+// pt above the last edge uses the last pt bin (as min(pt, ptmax-0.1) did).
+// If the x axis starts at 0 it is |eta|, and eta is folded with fabs.
+// With a covariance of the fake rate bins (such as the bootstrap <label>_fr_cov
+// of FakeRateFiller, over the flat bins iy*nbinsx+ix) the map also has the
+// covariance of the weights, for the errors of predictions summed over bins.
+//
+// A bin is found in constant time: each axis has a uniform grid of cells no
+// wider than its narrowest bin, so a cell holds at most one bin edge
+// (cell bounds are rounded, so the lookup checks the edges on both sides).
+
+class FakeRateMap
+{
+public:
+
+    FakeRateMap() : nbinsx_(0), nbinsy_(0), absEta_(true) {}
+
+    // throws std::invalid_argument for an empty histogram
+    explicit FakeRateMap(const TH2* fr)
+    {
+        Init(fr);
+    }
+
+    // throws std::invalid_argument if covariance is not NumBins x NumBins
+    FakeRateMap(const TH2* fr, const TH2* covariance)
+    {
+        Init(fr);
+        const int nbins = NumBins();
+        if (covariance->GetNbinsX() != nbins || covariance->GetNbinsY() != nbins)
+            throw std::invalid_argument(Form("FakeRateMap: %s is not a %d x %d covariance of %s", covariance->GetName(), nbins, nbins, fr->GetName()));
+
+        // d weight / d FR = 1/(1-FR)^2
+        std::vector<double> derivative(nbins, 0);
+        for (int ibin = 0; ibin < nbins; ibin++)
+            derivative[ibin] = (fr_[ibin] < 1) ? 1 / ((1 - fr_[ibin]) * (1 - fr_[ibin])) : 0;
+
+        weightCovariance_.resize(nbins * nbins);
+        for (int ibin = 0; ibin < nbins; ibin++)
+        {
+            for (int jbin = 0; jbin < nbins; jbin++)
+                weightCovariance_[ibin * nbins + jbin] = covariance->GetBinContent(ibin + 1, jbin + 1) * derivative[ibin] * derivative[jbin];
+        }
+    }
+
+    int NumBins() const {return nbinsx_ * nbinsy_;}
+
+    // flat bin of (eta, pt), always in [0, NumBins())
+    int Bin(double eta, double pt) const
+    {
+        return y_.Find(pt) * nbinsx_ + x_.Find(absEta_ ? fabs(eta) : eta);
+    }
+
+    double FakeRate     (int bin) const {return fr_[bin];}
+    double FakeRateError(int bin) const {return frError_[bin];}
+    double Weight       (int bin) const {return weight_[bin];}
+    double WeightError  (int bin) const {return weightError_[bin];}
+
+    double FakeRate     (double eta, double pt) const {return fr_[Bin(eta, pt)];}
+    double FakeRateError(double eta, double pt) const {return frError_[Bin(eta, pt)];}
+    double Weight       (double eta, double pt) const {return weight_[Bin(eta, pt)];}
+    double WeightError  (double eta, double pt) const {return weightError_[Bin(eta, pt)];}
+
+    // covariance of the weights of two bins (only with a covariance)
+    bool   HasCovariance() const {return !weightCovariance_.empty();}
+    double WeightCovariance(int ibin, int jbin) const {return weightCovariance_[ibin * NumBins() + jbin];}
+
+private:
+
+    void Init(const TH2* fr)
+    {
+        x_ = Axis(fr->GetXaxis());
+        y_ = Axis(fr->GetYaxis());
+        nbinsx_ = fr->GetNbinsX();
+        nbinsy_ = fr->GetNbinsY();
+        if (nbinsx_ < 1 || nbinsy_ < 1)
+            throw std::invalid_argument(Form("FakeRateMap: %s has no bins", fr->GetName()));
+        absEta_ = (fr->GetXaxis()->GetXmin() >= 0);
+
+        fr_.resize(nbinsx_ * nbinsy_);
+        frError_.resize(nbinsx_ * nbinsy_);
+        weight_.resize(nbinsx_ * nbinsy_);
+        weightError_.resize(nbinsx_ * nbinsy_);
+        for (int iy = 0; iy < nbinsy_; iy++)
+        {
+            for (int ix = 0; ix < nbinsx_; ix++)
+            {
+                const int bin = iy * nbinsx_ + ix;
+                const double value = fr->GetBinContent(ix + 1, iy + 1);
+                const double error = fr->GetBinError(ix + 1, iy + 1);
+                fr_[bin]      = value;
+                frError_[bin] = error;
+                if (value < 1)
+                {
+                    weight_[bin]      = value / (1 - value);
+                    weightError_[bin] = error / ((1 - value) * (1 - value));
+                }
+                else
+                {
+                    weight_[bin]      = 0;
+                    weightError_[bin] = 0;
+                }
+            }
+        }
+    }
+
+    struct Axis
+    {
+        Axis() : low(0), high(0), cellsPerUnit(0) {}
+
+        explicit Axis(const TAxis* axis)
+        {
+            const int nbins = axis->GetNbins();
+            for (int ibin = 1; ibin <= nbins + 1; ibin++)
+                edges.push_back(axis->GetBinLowEdge(ibin));
+            low  = edges.front();
+            high = edges.back();
+
+            double narrowest = high - low;
+            for (int ibin = 0; ibin < nbins; ibin++)
+                narrowest = std::min(narrowest, edges[ibin + 1] - edges[ibin]);
+            const int ncells = static_cast<int>(ceil((high - low) / narrowest)) + 1;
+            cellsPerUnit = (ncells - 1) / (high - low);
+
+            // bin of the low end of each cell
+            int ibin = 0;
+            for (int icell = 0; icell < ncells; icell++)
+            {
+                const double x = low + icell / cellsPerUnit;
+                while (ibin < nbins - 1 && x >= edges[ibin + 1])
+                    ++ibin;
+                cells.push_back(ibin);
+            }
+        }
+
+        // bin of x, clamped to [0, nbins)
+        int Find(double x) const
+        {
+            if (!(x > low))
+                return 0;
+            if (x >= high)
+                return edges.size() - 2;
+            int bin = cells[static_cast<int>((x - low) * cellsPerUnit)];
+            if (x >= edges[bin + 1])
+                ++bin;
+            else if (x < edges[bin])
+                --bin;
+            return bin;
+        }
+
+        std::vector<double> edges;
+        std::vector<int>    cells;
+        double              low;
+        double              high;
+        double              cellsPerUnit;
+    };
+
+    Axis x_;
+    Axis y_;
+    int  nbinsx_;
+    int  nbinsy_;
+    bool absEta_;
+
+    // flat tables, bin = iy * nbinsx + ix
+    std::vector<double> fr_;
+    std::vector<double> frError_;
+    std::vector<double> weight_;
+    std::vector<double> weightError_;
+    std::vector<double> weightCovariance_;   // [ibin * NumBins() + jbin]
+};
+
+#endif
@@ -0,0 +1,298 @@
+#include "GoodRunList.h"
+
+// C++ Includes
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <sys/stat.h>
+
+// ROOT Includes
+#include "TString.h"
+
+namespace
+{
+    const char kCacheMagic[8] = {'F', 'R', 'G', 'R', 'L', '0', '0', '1'};
+
+    struct LumiRange
+    {
+        unsigned int run, lumiMin, lumiMax;
+        bool operator < (const LumiRange& other) const
+        {
+            if (run != other.run)
+                return run < other.run;
+            return lumiMin < other.lumiMin;
+        }
+    };
+
+    template <class T> bool ReadArray(FILE* file, std::vector<T>& values, unsigned int size)
+    {
+        values.resize(size);
+        return (size == 0 || fread(&values[0], sizeof(T), size, file) == size);
+    }
+
+    template <class T> bool WriteArray(FILE* file, const std::vector<T>& values)
+    {
+        return (values.empty() || fwrite(&values[0], sizeof(T), values.size(), file) == values.size());
+    }
+}
+
+GoodRunList::GoodRunList()
+    : loaded_      ( false )
+    , lastRun_     ( 0     )
+    , lastLumiMin_ ( 1     )
+    , lastLumiMax_ ( 0     )
+    , runIndex_    ( -2    )
+{
+}
+
+void GoodRunList::Load(const std::string& fileName, bool isJson)
+{
+    struct stat source;
+    if (stat(fileName.c_str(), &source) != 0)
+    {
+        throw std::runtime_error(Form("[FR baby maker]: GoodRunList - cannot find good run list %s", fileName.c_str()));
+    }
+
+    // forget the previous lookups
+    lastRun_     = 0;
+    lastLumiMin_ = 1;
+    lastLumiMax_ = 0;
+    runIndex_    = -2;
+
+    const std::string cacheName = fileName + ".bin";
+    if (ReadCache(cacheName, source.st_size, source.st_mtime, isJson))
+    {
+        loaded_ = true;
+        std::cout << "[FR baby maker]: good run list read from " << cacheName << ": " << NumRuns() << " runs, " << NumRanges() << " lumi ranges" << std::endl;
+        return;
+    }
+
+    std::vector<unsigned int> runs, lumiMin, lumiMax;
+    if (isJson)
+        ParseJson(fileName, runs, lumiMin, lumiMax);
+    else
+        ParseText(fileName, runs, lumiMin, lumiMax);
+    Build(runs, lumiMin, lumiMax);
+    loaded_ = true;
+    std::cout << "[FR baby maker]: good run list " << fileName << ": " << NumRuns() << " runs, " << NumRanges() << " lumi ranges" << std::endl;
+
+    WriteCache(cacheName, source.st_size, source.st_mtime, isJson);
+}
+
+bool GoodRunList::Lookup(unsigned int run, unsigned int lumi)
+{
+    if (runs_.empty())
+        return true;
+
+    // new run: find it in the table
+    if (run != lastRun_ || runIndex_ == -2)
+    {
+        std::vector<unsigned int>::const_iterator it = std::lower_bound(runs_.begin(), runs_.end(), run);
+        runIndex_    = (it != runs_.end() && *it == run) ? (it - runs_.begin()) : -1;
+        lastRun_     = run;
+        lastLumiMin_ = 1;
+        lastLumiMax_ = 0;
+    }
+    if (runIndex_ < 0)
+        return false;
+
+    // last range starting at or before lumi
+    std::vector<unsigned int>::const_iterator begin = lumiMin_.begin() + first_[runIndex_];
+    std::vector<unsigned int>::const_iterator end   = lumiMin_.begin() + first_[runIndex_ + 1];
+    std::vector<unsigned int>::const_iterator it    = std::upper_bound(begin, end, lumi);
+    if (it == begin)
+        return false;
+
+    const unsigned int irange = (it - lumiMin_.begin()) - 1;
+    if (lumi > lumiMax_[irange])
+        return false;
+
+    lastLumiMin_ = lumiMin_[irange];
+    lastLumiMax_ = lumiMax_[irange];
+    return true;
+}
+
+// sort the ranges and merge the overlapping ones
+void GoodRunList::Build(std::vector<unsigned int>& runs, std::vector<unsigned int>& lumiMin, std::vector<unsigned int>& lumiMax)
+{
+    std::vector<LumiRange> ranges(runs.size());
+    for (unsigned int i = 0; i < runs.size(); i++)
+    {
+        ranges[i].run     = runs[i];
+        ranges[i].lumiMin = lumiMin[i];
+        ranges[i].lumiMax = lumiMax[i];
+    }
+    std::sort(ranges.begin(), ranges.end());
+
+    runs_.clear();
+    first_.clear();
+    lumiMin_.clear();
+    lumiMax_.clear();
+    for (unsigned int i = 0; i < ranges.size(); i++)
+    {
+        const LumiRange& range = ranges[i];
+        if (range.lumiMin > range.lumiMax)
+            continue;
+
+        if (runs_.empty() || runs_.back() != range.run)
+        {
+            runs_.push_back(range.run);
+            first_.push_back(lumiMin_.size());
+        }
+        else if (range.lumiMin <= lumiMax_.back() || range.lumiMin - lumiMax_.back() == 1)
+        {
+            lumiMax_.back() = std::max(lumiMax_.back(), range.lumiMax);
+            continue;
+        }
+        lumiMin_.push_back(range.lumiMin);
+        lumiMax_.push_back(range.lumiMax);
+    }
+    first_.push_back(lumiMin_.size());
+}
+
+// {"run": [[first, last], [first, last], ...], ...}
+void GoodRunList::ParseJson(const std::string& fileName, std::vector<unsigned int>& runs, std::vector<unsigned int>& lumiMin, std::vector<unsigned int>& lumiMax) const
+{
+    std::ifstream in(fileName.c_str());
+    if (!in)
+    {
+        throw std::runtime_error(Form("[FR baby maker]: GoodRunList - cannot open good run list %s", fileName.c_str()));
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    const std::string text = buffer.str();
+
+    size_t pos = 0;
+    while ((pos = text.find('"', pos)) != std::string::npos)
+    {
+        // run number
+        const size_t end = text.find('"', pos + 1);
+        if (end == std::string::npos)
+            break;
+        const unsigned int run = strtoul(text.substr(pos + 1, end - pos - 1).c_str(), NULL, 10);
+
+        // all the numbers until the list of the run is closed
+        pos = text.find('[', end);
+        if (pos == std::string::npos)
+            break;
+        std::vector<unsigned int> values;
+        int depth = 0;
+        for (; pos < text.size(); pos++)
+        {
+            const char c = text[pos];
+            if (c == '[')
+                ++depth;
+            else if (c == ']')
+            {
+                if (--depth == 0)
+                    break;
+            }
+            else if (isdigit(c))
+            {
+                char* next = NULL;
+                values.push_back(strtoul(text.c_str() + pos, &next, 10));
+                pos = (next - text.c_str()) - 1;
+            }
+        }
+        if (depth != 0 || values.size() % 2 != 0)
+        {
+            throw std::runtime_error(Form("[FR baby maker]: GoodRunList - malformed lumi ranges for run %u in %s", run, fileName.c_str()));
+        }
+        for (unsigned int i = 0; i < values.size(); i += 2)
+        {
+            runs.push_back(run);
+            lumiMin.push_back(values[i]);
+            lumiMax.push_back(values[i + 1]);
+        }
+        ++pos;
+    }
+}
+
+// run first_lumi last_lumi
+void GoodRunList::ParseText(const std::string& fileName, std::vector<unsigned int>& runs, std::vector<unsigned int>& lumiMin, std::vector<unsigned int>& lumiMax) const
+{
+    std::ifstream in(fileName.c_str());
+    if (!in)
+    {
+        throw std::runtime_error(Form("[FR baby maker]: GoodRunList - cannot open good run list %s", fileName.c_str()));
+    }
+
+    std::string line;
+    unsigned int nline = 0;
+    while (std::getline(in, line))
+    {
+        ++nline;
+        line = line.substr(0, line.find('#'));
+        if (line.find_first_not_of(" \t\r") == std::string::npos)
+            continue;
+
+        std::istringstream fields(line);
+        unsigned int run = 0, first = 0, last = 0;
+        if (!(fields >> run >> first >> last))
+        {
+            throw std::runtime_error(Form("[FR baby maker]: GoodRunList - cannot parse line %u of %s", nline, fileName.c_str()));
+        }
+        runs.push_back(run);
+        lumiMin.push_back(first);
+        lumiMax.push_back(last);
+    }
+}
+
+bool GoodRunList::ReadCache(const std::string& cacheName, long long sourceSize, long long sourceTime, bool isJson)
+{
+    FILE* file = fopen(cacheName.c_str(), "rb");
+    if (!file)
+        return false;
+
+    char magic[sizeof(kCacheMagic)];
+    long long size = -1, time = -1;
+    unsigned char json = 0;
+    unsigned int nRuns = 0, nRanges = 0;
+    bool ok = (fread(magic, sizeof(magic), 1, file) == 1 && memcmp(magic, kCacheMagic, sizeof(magic)) == 0 &&
+               fread(&size   , sizeof(size)   , 1, file) == 1 && size == sourceSize &&
+               fread(&time   , sizeof(time)   , 1, file) == 1 && time == sourceTime &&
+               fread(&json   , sizeof(json)   , 1, file) == 1 && json == (isJson ? 1 : 0) &&
+               fread(&nRuns  , sizeof(nRuns)  , 1, file) == 1 &&
+               fread(&nRanges, sizeof(nRanges), 1, file) == 1);
+    ok = ok && ReadArray(file, runs_, nRuns) && ReadArray(file, first_, nRuns + 1) && ReadArray(file, lumiMin_, nRanges) && ReadArray(file, lumiMax_, nRanges);
+    ok = ok && (first_.front() == 0 && first_.back() == nRanges);
+    fclose(file);
+
+    if (!ok)
+    {
+        runs_.clear();
+        first_.clear();
+        lumiMin_.clear();
+        lumiMax_.clear();
+    }
+    return ok;
+}
+
+// the cache is only an optimization: failing to write it is not an error
+void GoodRunList::WriteCache(const std::string& cacheName, long long sourceSize, long long sourceTime, bool isJson) const
+{
+    const std::string tmpName = cacheName + ".tmp";
+    FILE* file = fopen(tmpName.c_str(), "wb");
+    if (!file)
+        return;
+
+    const unsigned char json = isJson ? 1 : 0;
+    const unsigned int nRuns = runs_.size(), nRanges = lumiMin_.size();
+    bool ok = (fwrite(kCacheMagic, sizeof(kCacheMagic), 1, file) == 1 &&
+               fwrite(&sourceSize, sizeof(sourceSize), 1, file) == 1 &&
+               fwrite(&sourceTime, sizeof(sourceTime), 1, file) == 1 &&
+               fwrite(&json      , sizeof(json)      , 1, file) == 1 &&
+               fwrite(&nRuns     , sizeof(nRuns)     , 1, file) == 1 &&
+               fwrite(&nRanges   , sizeof(nRanges)   , 1, file) == 1);
+    ok = ok && WriteArray(file, runs_) && WriteArray(file, first_) && WriteArray(file, lumiMin_) && WriteArray(file, lumiMax_);
+    ok = (fclose(file) == 0) && ok;
+
+    if (!ok || rename(tmpName.c_str(), cacheName.c_str()) != 0)
+        remove(tmpName.c_str());
+}
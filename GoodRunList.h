@@ -0,0 +1,63 @@
+#ifndef GoodRunList_h
+#define GoodRunList_h
+
+// C++ Includes
+#include <string>
+#include <vector>
+
+// Good run list compiled into a flat table for the event loop.
+//
+// The runs are kept sorted, each with a sorted and merged list of good lumi
+// ranges.  The last run and the last lumi range looked up are cached, so the
+// events of the same lumi section pass the check with a couple of compares.
+//
+// Both the JSON format ({"run": [[first, last], ...], ...}) and the text
+// format ("run first_lumi last_lumi" per line, '#' comments) are read.
+// The parsed table is cached in <fileName>.bin and reused by later jobs
+// as long as the size and modification time of fileName are unchanged.
+class GoodRunList
+{
+public:
+
+    GoodRunList();
+
+    // parse fileName (or read its binary cache); throws if the file cannot be read
+    void Load(const std::string& fileName, bool isJson);
+
+    bool Loaded() const {return loaded_;}
+
+    // an empty list accepts everything (as in Tools/goodrun)
+    bool Contains(unsigned int run, unsigned int lumi)
+    {
+        if (lumi >= lastLumiMin_ && lumi <= lastLumiMax_ && run == lastRun_)
+            return true;
+        return Lookup(run, lumi);
+    }
+
+    unsigned int NumRuns() const {return runs_.size();}
+    unsigned int NumRanges() const {return lumiMin_.size();}
+
+private:
+
+    bool Lookup(unsigned int run, unsigned int lumi);
+    void Build(std::vector<unsigned int>& runs, std::vector<unsigned int>& lumiMin, std::vector<unsigned int>& lumiMax);
+    void ParseJson(const std::string& fileName, std::vector<unsigned int>& runs, std::vector<unsigned int>& lumiMin, std::vector<unsigned int>& lumiMax) const;
+    void ParseText(const std::string& fileName, std::vector<unsigned int>& runs, std::vector<unsigned int>& lumiMin, std::vector<unsigned int>& lumiMax) const;
+    bool ReadCache(const std::string& cacheName, long long sourceSize, long long sourceTime, bool isJson);
+    void WriteCache(const std::string& cacheName, long long sourceSize, long long sourceTime, bool isJson) const;
+
+    // runs_[i] has the lumi ranges [first_[i], first_[i+1])
+    std::vector<unsigned int> runs_;
+    std::vector<unsigned int> first_;
+    std::vector<unsigned int> lumiMin_;
+    std::vector<unsigned int> lumiMax_;
+    bool loaded_;
+
+    // cache of the last lookup
+    unsigned int lastRun_;
+    unsigned int lastLumiMin_;
+    unsigned int lastLumiMax_;
+    int          runIndex_;  // index of lastRun_ in runs_ (-1 if not a good run, -2 before the first lookup)
+};
+
+#endif
@@ -4,94 +4,204 @@ histio()
 
 saveHist(const char* filename, const char* pat="*") 
 {
-  TList* list = gDirectory->GetList() ;
-  TIterator* iter = list->MakeIterator();
+  saveHistBatch(filename,pat) ;
+}
 
-  TRegexp re(pat,kTRUE) ;
 
-  TFile outf(filename,"RECREATE") ;
-  while(obj=iter->Next()) {    
+// Save the histograms of the memory dir matching pat in one batch:
+// they are collected first, then written in a single session of the file
+// with the given compression (algorithm zlib, lzma, lz4 or zstd, level 0-9).
+//
+// mode is RECREATE (the file is replaced), UPDATE (the objects in the file
+// with the same names are replaced, the others kept) or APPEND (new cycles
+// are added next to the existing ones).  The file is written as a temporary
+// file in the same directory and renamed over filename only once it is
+// complete, so an interrupted save leaves the old file untouched.
+
+saveHistBatch(const char* filename, const char* pat="*", const char* mode="RECREATE", const char* algorithm="zlib", Int_t level=1)
+{
+  TString opt(mode) ;
+  opt.ToUpper() ;
+  if (opt!="RECREATE" && opt!="UPDATE" && opt!="APPEND") {
+    cout << "saveHist: unknown mode " << mode << " (RECREATE, UPDATE or APPEND)" << endl ;
+    return ;
+  }
+
+  TString alg(algorithm) ;
+  alg.ToLower() ;
+  Int_t code = 0 ;
+  if (alg=="zlib") code = 1 ;
+  else if (alg=="lzma") code = 2 ;
+  else if (alg=="lz4") code = 4 ;
+  else if (alg=="zstd") code = 5 ;
+  if (code==0 || level<0 || level>9) {
+    cout << "saveHist: bad compression " << algorithm << " " << level << " (zlib, lzma, lz4 or zstd, level 0-9)" << endl ;
+    return ;
+  }
+
+  // collect the matching objects first
+  TRegexp re(pat,kTRUE) ;
+  TList batch ;
+  TIter next(gDirectory->GetList()) ;
+  TObject* obj ;
+  while((obj=next())) {
     if (TString(obj->GetName()).Index(re)>=0) {
-      obj->Write() ;
-      cout << "." ;
-      cout.flush() ;
+      batch.Add(obj) ;
     }
   }
-  cout << endl ;
-  outf.Close() ;
 
-  delete iter ;
+  // write them to a temporary file next to the output
+  TString tmpname = Form("%s.tmp%d",filename,gSystem->GetPid()) ;
+  Bool_t exists = !gSystem->AccessPathName(filename) ;
+  if (opt!="RECREATE" && exists && gSystem->CopyFile(filename,tmpname,kTRUE)!=0) {
+    cout << "saveHist: cannot copy " << filename << " to " << tmpname << endl ;
+    return ;
+  }
+
+  TDirectory* save = gDirectory ;
+  TFile* outf = TFile::Open(tmpname,(opt!="RECREATE" && exists)?"UPDATE":"RECREATE") ;
+  save->cd() ;
+  if (!outf || outf->IsZombie()) {
+    cout << "saveHist: cannot write " << tmpname << endl ;
+    delete outf ;
+    gSystem->Unlink(tmpname) ;
+    return ;
+  }
+  outf->SetCompressionSettings(100*code+level) ;
+
+  Bool_t ok = kTRUE ;
+  const char* wopt = (opt=="UPDATE") ? "WriteDelete" : "" ;
+  TIter nextBatch(&batch) ;
+  while(ok && (obj=nextBatch())) {
+    ok = (outf->WriteTObject(obj,obj->GetName(),wopt) > 0) ;
+  }
+  outf->Close() ;
+  ok = ok && !outf->TestBit(TFile::kWriteError) ;
+  delete outf ;
+
+  if (!ok || gSystem->Rename(tmpname,filename)!=0) {
+    cout << "saveHist: could not save " << filename << ", the file is unchanged" << endl ;
+    gSystem->Unlink(tmpname) ;
+    return ;
+  }
+  cout << "saveHist: " << batch.GetSize() << " objects saved in " << filename << endl ;
 }
 
 
-loadHist(const char* filename, const char* pfx=0, const char* pat="*", Bool_t doAdd=kFALSE) 
-{
-  TFile inf(filename) ;
-  //inf.ReadAll() ;
-  TList* list = inf.GetListOfKeys() ;
-  TIterator* iter = list->MakeIterator();
+// Index of the histograms of a file, read lazily.
+//
+// The matching keys of the file (highest cycle of each name) are put in a
+// hashed index under their name in memory (pfx_name with a prefix); Get reads
+// a histogram the first time it is asked for, and LoadAll reads them all.
+// The target directory is looked up by name in its hash list, so loading n
+// histograms is linear in n.  The file stays open while the index exists.
+// The histograms go to the current directory when the index is made.
+//
+//   root> HistIndex* fr = new HistIndex("FakeRates30August.root") ;
+//   root> TH2F* h = (TH2F*) fr->Get("muFR15u") ;
 
-  TRegexp re(pat,kTRUE) ;
-  cout << "pat = " << pat << endl ;
+class HistIndex {
+public:
 
-  gDirectory->cd("Rint:") ;
+  HistIndex(const char* filename, const char* pfx=0, const char* pat="*", Bool_t doAdd=kFALSE) :
+    _dir(gDirectory), _file(TFile::Open(filename)), _pfx(pfx?pfx:""), _doAdd(doAdd)
+  {
+    _dir->cd() ;
+    _pending.SetOwner(kTRUE) ;
+    if (!_file || _file->IsZombie()) {
+      cout << "HistIndex: cannot open " << filename << endl ;
+      return ;
+    }
 
-  TObject* obj ;
-  TKey* key ;
-  cout << "doAdd = " << (doAdd?"T":"F") << endl ;
-  cout << "loadHist: reading." ;
-  while(key=(TKey*)iter->Next()) {
-   
-    Int_t ridx = TString(key->GetName()).Index(re) ;    
-    if (ridx==-1) {
-      continue ;
+    TRegexp re(pat,kTRUE) ;
+    TIter next(_file->GetListOfKeys()) ;
+    TKey* key ;
+    while((key=(TKey*)next())) {
+      if (TString(key->GetName()).Index(re)==-1) continue ;
+      TString name = _pfx.Length() ? Form("%s_%s",_pfx.Data(),key->GetName()) : key->GetName() ;
+      // the keys are sorted with the highest cycle first
+      if (_pending.FindObject(name.Data())) continue ;
+      _pending.Add(new TNamed(name.Data(),Form("%s;%d",key->GetName(),key->GetCycle()))) ;
     }
+  }
 
-    obj = inf.Get(key->GetName()) ;
-    TObject* clone ;
-    if (pfx) {
-
-      // Find existing TH1-derived objects
-      TObject* oldObj = 0 ;
-      if (doAdd){
-	oldObj = gDirectory->Get(Form("%s_%s",pfx,obj->GetName())) ;
-	if (oldObj && !oldObj->IsA()->InheritsFrom(TH1::Class())) {
-	  oldObj = 0 ;
-	}
-      }
-      if (oldObj) {
-	clone = oldObj ;
-	((TH1*)clone)->Add((TH1*)obj) ;
-      } else {
-	clone = obj->Clone(Form("%s_%s",pfx,obj->GetName())) ;
-      }
+  ~HistIndex() { if (_file) _file->Close() ; delete _file ; }
 
+  // number of histograms not read yet
+  Int_t GetNPending() const { return _pending.GetSize() ; }
 
-    } else {
+  // the object named name in memory, read from the file on first access
+  TObject* Get(const char* name) {
+    TNamed* entry = (TNamed*) _pending.FindObject(name) ;
+    if (entry) {
+      Load(entry) ;
+      _pending.Remove(entry) ;
+      delete entry ;
+    }
+    return _dir->GetList()->FindObject(name) ;
+  }
+
+  // read everything still pending
+  void LoadAll() {
+    TIter next(&_pending) ;
+    TNamed* entry ;
+    while((entry=(TNamed*)next())) {
+      Load(entry) ;
+      cout << "." ;
+      cout.flush() ;
+    }
+    _pending.Delete() ;
+  }
+
+private:
+
+  void Load(TNamed* entry) {
+    TObject* obj = _file->Get(entry->GetTitle()) ;
+    if (!obj) return ;
 
-      // Find existing TH1-derived objects
-      TObject* oldObj = 0 ;
-      if (doAdd){
-	oldObj = gDirectory->Get(key->GetName()) ;
-	if (oldObj && !oldObj->IsA()->InheritsFrom(TH1::Class())) {
-	  oldObj = 0 ;
-	}
+    // Find existing TH1-derived objects
+    TObject* oldObj = 0 ;
+    if (_doAdd) {
+      oldObj = _dir->GetList()->FindObject(entry->GetName()) ;
+      if (oldObj && !oldObj->IsA()->InheritsFrom(TH1::Class())) {
+	oldObj = 0 ;
       }
+    }
 
-      if (oldObj) {
-	clone = oldObj ;
-	((TH1*)clone)->Add((TH1*)obj) ;
+    if (oldObj) {
+      ((TH1*)oldObj)->Add((TH1*)obj) ;
+    } else {
+      TDirectory* save = gDirectory ;
+      _dir->cd() ;
+      TObject* clone = obj->Clone(entry->GetName()) ;
+      // no FindObject(clone): that is a linear scan of the directory
+      if (clone->IsA()->InheritsFrom(TH1::Class())) {
+	((TH1*)clone)->SetDirectory(_dir) ;
       } else {
-	clone = obj->Clone() ;
+	_dir->Append(clone) ;
       }
+      save->cd() ;
     }
-    if (!gDirectory->GetList()->FindObject(clone)) {
-      gDirectory->Append(clone) ;
-    }
-    cout << "." ;
-    cout.flush() ;
+    delete obj ;
   }
+
+  TDirectory* _dir ;     // directory the histograms are loaded in (set before _file is opened)
+  TFile*      _file ;
+  TString     _pfx ;
+  Bool_t      _doAdd ;
+  THashList   _pending ; // name in memory -> "key;cycle" of the histograms not read yet
+} ;
+
+
+loadHist(const char* filename, const char* pfx=0, const char* pat="*", Bool_t doAdd=kFALSE) 
+{
+  cout << "pat = " << pat << endl ;
+  cout << "doAdd = " << (doAdd?"T":"F") << endl ;
+
+  gDirectory->cd("Rint:") ;
+
+  HistIndex index(filename,pfx,pat,doAdd) ;
+  cout << "loadHist: reading." ;
+  index.LoadAll() ;
   cout << endl;
-  inf.Close() ;
-  delete iter ;
 }
@@ -0,0 +1,668 @@
+// Baby ntuple variables.
+//
+// This file is included several times by myBabyMaker with different
+// definitions of the macros below, to declare the members, to set them
+// to their defaults (constructor and InitBabyNtuple) and to book the branches:
+//
+//   BABY_BRANCH  (type, member, branch name, default, group)
+//   BABY_VARIABLE(type, member, default, group)         (not written to the baby)
+//   BABY_FLAG    (member, branch name, group)           (Bool_t selection flag, false by default)
+//   BABY_TRIGGER (trigger, group)                       (only used for the compact trigger block: the
+//                                                        members <trigger>_vstar_, <trigger>_version_,
+//                                                        dr_<trigger>_vstar_ and hltps_<trigger>_vstar_)
+//
+// The group decides if the branch is booked for the selected branch profile
+// (see myBabyMaker::SetBranchProfile).  The flags can be written packed in
+// bit words instead of one branch each (see myBabyMaker::SetPackSelections).
+// To add a variable to the baby, add a line here and fill the member in ScanChain.
+//
+// No include guard on purpose.
+
+#ifndef BABY_TRIGGER
+#define BABY_TRIGGER(trigger, group)
+#endif
+
+///////////////////////////
+// Event Information     //
+///////////////////////////
+
+// Basic Event Information
+BABY_BRANCH  (Int_t,   run_,          "run",          -1,    kBabyEvent)
+BABY_BRANCH  (Int_t,   ls_,           "ls",           -1,    kBabyEvent)
+BABY_BRANCH  (UInt_t,  evt_,          "evt",          0,     kBabyEvent)
+BABY_BRANCH  (Float_t, weight_,       "weight",       1.0,   kBabyEvent)
+BABY_BRANCH  (Int_t,   dataset_idx_,  "dataset_idx",  -1,    kBabyEvent) // index in the dataset names of the file (see BabyMetadata.h)
+BABY_BRANCH  (Int_t,   filename_idx_, "filename_idx", -1,    kBabyEvent) // index in the input file names of the file (see BabyMetadata.h)
+BABY_BRANCH  (Bool_t,  is_real_data_, "is_real_data", false, kBabyEvent)
+
+// Pileup - PUSummaryInfoMaker
+BABY_BRANCH  (Int_t,   pu_nPUvertices_, "pu_nPUvertices", -1,   kBabyEvent)
+BABY_BRANCH  (Float_t, pu_nPUtrueint_,  "pu_nPUtrueint",  -1.0, kBabyEvent)
+
+// Pileup - VertexMaker
+BABY_BRANCH  (Int_t, evt_nvtxs_, "evt_nvtxs", -1, kBabyEvent)
+
+// event level variables (number of additional objects besides the FO under consideration)
+BABY_BRANCH  (Int_t, nFOels_,   "nFOels",   0, kBabyEvent)
+BABY_BRANCH  (Int_t, nFOmus_,   "nFOmus",   0, kBabyEvent)
+BABY_BRANCH  (Int_t, ngsfs_,    "ngsfs",    0, kBabyEvent)
+BABY_BRANCH  (Int_t, nmus_,     "nmus",     0, kBabyEvent)
+BABY_BRANCH  (Int_t, nvetoels_, "nvetoels", 0, kBabyEvent)
+BABY_BRANCH  (Int_t, nvetomus_, "nvetomus", 0, kBabyEvent)
+
+///////////////////////////
+// End Event Information //
+///////////////////////////
+
+
+
+//////////////////////////
+// Lepton Variables     //
+//////////////////////////
+
+// Lepton pt and eta and phi
+BABY_BRANCH  (Float_t, pt_,    "pt",    -999., kBabyLepton)
+BABY_BRANCH  (Float_t, eta_,   "eta",   -999., kBabyLepton)
+BABY_BRANCH  (Float_t, sceta_, "sceta", -999., kBabyLepton)
+BABY_BRANCH  (Float_t, phi_,   "phi",   -999., kBabyLepton)
+BABY_BRANCH  (Float_t, scet_,  "scet",  -999., kBabyLepton)
+BABY_BRANCH  (Int_t,   id_,    "id",    -1,    kBabyLepton) // \pm 11 or \pm 13
+BABY_BRANCH  (Float_t, hoe_,   "hoe",   -999., kBabyLepton)
+
+// ip
+BABY_BRANCH  (Float_t, d0_,      "d0",      -999., kBabyLepton)
+BABY_BRANCH  (Float_t, d0err_,   "d0err",   -999., kBabyLepton)
+BABY_BRANCH  (Float_t, dz_,      "dz",      -999., kBabyLepton)
+BABY_BRANCH  (Float_t, dzerr_,   "dzerr",   -999., kBabyLepton)
+BABY_BRANCH  (Float_t, ip3d_,    "ip3d",    -999., kBabyLepton)
+BABY_BRANCH  (Float_t, ip3derr_, "ip3derr", -999., kBabyLepton)
+
+// some useful lepton 4 vectors
+BABY_BRANCH  (LorentzVector, lp4_,       "lp4",       LorentzVector(0,0,0,0), kBabyLepton) // 4-vector of the lepton
+BABY_BRANCH  (LorentzVector, foel_p4_,   "foel_p4",   LorentzVector(0,0,0,0), kBabyLepton) // 4-vector of the highest additional electron FO in the event
+BABY_BRANCH  (Int_t,         foel_id_,   "foel_id",   -999,                   kBabyLepton)
+BABY_BRANCH  (LorentzVector, fomu_p4_,   "fomu_p4",   LorentzVector(0,0,0,0), kBabyLepton) // 4-vector of the highest additional muon FO in the event
+BABY_BRANCH  (Int_t,         fomu_id_,   "fomu_id",   -999,                   kBabyLepton)
+BABY_BRANCH  (Float_t,       foel_mass_, "foel_mass", -999.0,                 kBabyLepton)
+BABY_BRANCH  (Float_t,       fomu_mass_, "fomu_mass", -999.0,                 kBabyLepton)
+
+// pfmet
+BABY_BRANCH  (Float_t, pfmet_,    "pfmet",    -999., kBabyLepton)
+BABY_BRANCH  (Float_t, pfmetphi_, "pfmetphi", -999., kBabyLepton)
+
+// isolation
+BABY_BRANCH  (Float_t, iso_,                "iso",          -999., kBabyIsolation) // Relative Isolation
+BABY_BRANCH  (Float_t, iso_nps_,            "iso_nps",      -999., kBabyIsolation) // Relative Isolation ( 1 GeV pedestal subtraction in ecal barrel )
+BABY_BRANCH  (Float_t, trck_iso_,           "trck_iso",     -999., kBabyIsolation) // TRK Isolation (not relative)
+BABY_BRANCH  (Float_t, ecal_iso_,           "ecal_iso",     -999., kBabyIsolation) // ECAL Isolation ( not relative)
+BABY_BRANCH  (Float_t, ecal_iso_nps_,       "ecal_iso_nps", -999., kBabyIsolation) // ECAL Isolation ( not relaive, 1 GeV pedestal subtraction in ecal barrel )
+BABY_BRANCH  (Float_t, hcal_iso_,           "hcal_iso",     -999., kBabyIsolation) // HCAL Isolation ( not relative )
+BABY_BRANCH  (Float_t, pfiso03_,            "pfiso03",      -999., kBabyIsolation) // PF Isolation with a cone size of 0.3
+BABY_BRANCH  (Float_t, ch_pfiso03_,         "ch_pfiso03",   -999., kBabyIsolation) // Charged Hadron PF Isolation with a cone size of 0.3
+BABY_BRANCH  (Float_t, nh_pfiso03_,         "nh_pfiso03",   -999., kBabyIsolation) // Neutral Hadron PF Isolation with a cone size of 0.3
+BABY_BRANCH  (Float_t, em_pfiso03_,         "em_pfiso03",   -999., kBabyIsolation) // E&M PF Isolation with a cone size of 0.3
+BABY_VARIABLE(Float_t, pfiso03_bv_,                         -999., kBabyIsolation) // PF Isolation with a cone size of 0.3 (barrel veto)
+BABY_VARIABLE(Float_t, ch_pfiso03_bv_,                      -999., kBabyIsolation) // Charged Hadron PF Isolation with a cone size of 0.3 (barrel veto)
+BABY_VARIABLE(Float_t, nh_pfiso03_bv_,                      -999., kBabyIsolation) // Neutral Hadron PF Isolation with a cone size of 0.3 (barrel veto)
+BABY_VARIABLE(Float_t, em_pfiso03_bv_,                      -999., kBabyIsolation) // E&M PF Isolation with a cone size of 0.3 (barrel veto)
+BABY_BRANCH  (Float_t, pfiso04_,            "pfiso04",      -999., kBabyIsolation) // PF Isolation with a cone size of 0.4
+BABY_BRANCH  (Float_t, ch_pfiso04_,         "ch_pfiso04",   -999., kBabyIsolation) // Charged Hadron PF Isolation with a cone size of 0.4
+BABY_BRANCH  (Float_t, nh_pfiso04_,         "nh_pfiso04",   -999., kBabyIsolation) // Neutral Hadron  PF Isolation with a cone size of 0.4
+BABY_BRANCH  (Float_t, em_pfiso04_,         "em_pfiso04",   -999., kBabyIsolation) // E&M PF Isolation with a cone size of 0.4
+BABY_VARIABLE(Float_t, pfiso04_bv_,                         -999., kBabyIsolation) // PF Isolation with a cone size of 0.4 (barrel veto)
+BABY_VARIABLE(Float_t, ch_pfiso04_bv_,                      -999., kBabyIsolation) // Charged Hadron PF Isolation with a cone size of 0.4 (barrel veto)
+BABY_VARIABLE(Float_t, nh_pfiso04_bv_,                      -999., kBabyIsolation) // Neutral Hadron  PF Isolation with a cone size of 0.4 (barrel veto)
+BABY_VARIABLE(Float_t, em_pfiso04_bv_,                      -999., kBabyIsolation) // E&M PF Isolation with a cone size of 0.4 (barrel veto)
+BABY_VARIABLE(Float_t, radiso_et1p0_,                       -999., kBabyIsolation) // Radial Isolation with a cone size of 0.3, neutral ET threashold of 1.0
+BABY_VARIABLE(Float_t, ch_radiso_et1p0_,                    -999., kBabyIsolation) // Charged Hadron Radial Isolation with a cone size of 0.3, neutral ET threashold of 1.0
+BABY_VARIABLE(Float_t, nh_radiso_et1p0_,                    -999., kBabyIsolation) // Neutral Hadron  Radial Isolation with a cone size of 0.3, neutral ET threashold of 1.0
+BABY_VARIABLE(Float_t, em_radiso_et1p0_,                    -999., kBabyIsolation) // E&M Radial Isolation with a cone size of 0.3, neutral ET threashold of 1.0
+BABY_VARIABLE(Float_t, radiso_et1p0_bv_,                    -999., kBabyIsolation) // Radial Isolation with a cone size of 0.3, neutral ET threashold of 1.0 (barrel veto)
+BABY_VARIABLE(Float_t, ch_radiso_et1p0_bv_,                 -999., kBabyIsolation) // Charged Hadron Radial Isolation with a cone size of 0.3, neutral ET threashold of 1.0 (barrel veto)
+BABY_VARIABLE(Float_t, nh_radiso_et1p0_bv_,                 -999., kBabyIsolation) // Neutral Hadron  Radial Isolation with a cone size of 0.3, neutral ET threashold of 1.0 (barrel veto)
+BABY_VARIABLE(Float_t, em_radiso_et1p0_bv_,                 -999., kBabyIsolation) // E&M Radial Isolation with a cone size of 0.3, neutral ET threashold of 1.0 (barrel veto)
+BABY_VARIABLE(Float_t, radiso_et0p5_,                       -999., kBabyIsolation) // Radial Isolation with a cone size of 0.3, neutral ET threashold of 0.5
+BABY_VARIABLE(Float_t, ch_radiso_et0p5_,                    -999., kBabyIsolation) // Charged Hadron Radial Isolation with a cone size of 0.3, neutral ET threashold of 0.5
+BABY_VARIABLE(Float_t, nh_radiso_et0p5_,                    -999., kBabyIsolation) // Neutral Hadron  Radial Isolation with a cone size of 0.3, neutral ET threashold of 0.5
+BABY_VARIABLE(Float_t, em_radiso_et0p5_,                    -999., kBabyIsolation) // E&M Radial Isolation with a cone size of 0.3, neutral ET threashold of 0.5
+BABY_VARIABLE(Float_t, radiso_et0p5_bv_,                    -999., kBabyIsolation) // Radial Isolation with a cone size of 0.3, neutral ET threashold of 0.5 (barrel veto)
+BABY_VARIABLE(Float_t, ch_radiso_et0p5_bv_,                 -999., kBabyIsolation) // Charged Hadron Radial Isolation with a cone size of 0.3, neutral ET threashold of 0.5 (barrel veto)
+BABY_VARIABLE(Float_t, nh_radiso_et0p5_bv_,                 -999., kBabyIsolation) // Neutral Hadron  Radial Isolation with a cone size of 0.3, neutral ET threashold of 0.5 (barrel veto)
+BABY_VARIABLE(Float_t, em_radiso_et0p5_bv_,                 -999., kBabyIsolation) // E&M Radial Isolation with a cone size of 0.3, neutral ET threashold of 0.5 (barrel veto)
+BABY_BRANCH  (Float_t, pfpupt03_,           "pfpupt03",     -999., kBabyIsolation) // PF Pile Up sum pT (cone 0.3) (a.k.a. DeltaBeta)
+BABY_BRANCH  (Float_t, pfpupt04_,           "pfpupt04",     -999., kBabyIsolation) // PF Pile Up sum pT (cone 0.4) (a.k.a. DeltaBeta)
+
+// Corrected Isolation
+BABY_BRANCH  (Float_t, cpfiso03_rho_, "cpfiso03_rho", -999., kBabyIsolation) // PF Isolation with a cone size of 0.3 (corrected using rho*area_eff -- only filled for electrons)
+BABY_BRANCH  (Float_t, cpfiso04_rho_, "cpfiso04_rho", -999., kBabyIsolation) // PF Isolation with a cone size of 0.4 (corrected using rho*area_eff -- only filled for electrons)
+BABY_BRANCH  (Float_t, cpfiso03_db_,  "cpfiso03_db",  -999., kBabyIsolation) // PF Isolation with a cone size of 0.3 (corrected using #DeltaBeta -- only filled for muons)
+
+// PV
+BABY_BRANCH  (Float_t, d0PV_wwV1_, "d0PV_wwV1", -999., kBabyLepton) // electron_d0PV_wwV1(iEl)
+BABY_BRANCH  (Float_t, dzPV_wwV1_, "dzPV_wwV1", -999., kBabyLepton) // electron_dzPV_wwV1(iEl)
+
+// Id
+BABY_BRANCH  (Bool_t,  closestMuon_,   "closestMuon",   false, kBabyLepton) // true if els_closestMuon().at(index) == -1
+BABY_BRANCH  (Float_t, el_id_sieie_,   "el_id_sieie",   -999., kBabyLepton)
+BABY_BRANCH  (Float_t, el_id_detain_,  "el_id_detain",  -999., kBabyLepton)
+BABY_BRANCH  (Float_t, el_id_dphiin_,  "el_id_dphiin",  -999., kBabyLepton)
+BABY_BRANCH  (Bool_t,  el_id_smurfV5_, "el_id_smurfV5", false, kBabyLepton)
+BABY_BRANCH  (Bool_t,  el_id_vbtf80_,  "el_id_vbtf80",  false, kBabyLepton)
+BABY_BRANCH  (Bool_t,  el_id_vbtf90_,  "el_id_vbtf90",  false, kBabyLepton)
+
+// effective area
+BABY_BRANCH  (Float_t, el_effarea03_,          "el_effarea03",          -999., kBabyLepton) // 2012 working point effective area (cone = 0.3)
+BABY_BRANCH  (Float_t, el_effarea04_,          "el_effarea04",          -999., kBabyLepton) // 2012 working point effective area (cone = 0.4)
+BABY_BRANCH  (Float_t, mu_effarea03_,          "mu_effarea03",          -999., kBabyLepton) // 2012 working point effective area (combined       , cone = 0.3 , loose)
+BABY_BRANCH  (Float_t, mu_nh_effarea03_,       "mu_nh_effarea03",       -999., kBabyLepton) // 2012 working point effective area (neutral hadron , cone = 0.3 , loose)
+BABY_BRANCH  (Float_t, mu_em_effarea03_,       "mu_em_effarea03",       -999., kBabyLepton) // 2012 working point effective area (E&M            , cone = 0.3 , loose)
+BABY_BRANCH  (Float_t, mu_effarea03_tight_,    "mu_effarea03_tight",    -999., kBabyLepton) // 2012 working point effective area (combined       , cone = 0.3 , tight)
+BABY_BRANCH  (Float_t, mu_nh_effarea03_tight_, "mu_nh_effarea03_tight", -999., kBabyLepton) // 2012 working point effective area (neutral hadron , cone = 0.3 , tight)
+BABY_BRANCH  (Float_t, mu_em_effarea03_tight_, "mu_em_effarea03_tight", -999., kBabyLepton) // 2012 working point effective area (E&M            , cone = 0.3 , tight)
+BABY_BRANCH  (Float_t, mu_effarea04_,          "mu_effarea04",          -999., kBabyLepton) // 2012 working point effective area (combined       , cone = 0.4 , loose)
+BABY_BRANCH  (Float_t, mu_nh_effarea04_,       "mu_nh_effarea04",       -999., kBabyLepton) // 2012 working point effective area (neutral hadron , cone = 0.4 , loose)
+BABY_BRANCH  (Float_t, mu_em_effarea04_,       "mu_em_effarea04",       -999., kBabyLepton) // 2012 working point effective area (E&M            , cone = 0.4 , loose)
+BABY_BRANCH  (Float_t, mu_effarea04_tight_,    "mu_effarea04_tight",    -999., kBabyLepton) // 2012 working point effective area (combined       , cone = 0.4 , tight)
+BABY_BRANCH  (Float_t, mu_nh_effarea04_tight_, "mu_nh_effarea04_tight", -999., kBabyLepton) // 2012 working point effective area (neutral hadron , cone = 0.4 , tight)
+BABY_BRANCH  (Float_t, mu_em_effarea04_tight_, "mu_em_effarea04_tight", -999., kBabyLepton) // 2012 working point effective area (E&M            , cone = 0.4 , tight)
+
+// Z mass variables
+BABY_BRANCH  (Float_t, mz_fo_gsf_,       "mz_fo_gsf",       -999., kBabyLepton)
+BABY_BRANCH  (Float_t, mz_gsf_iso_,      "mz_gsf_iso",      -999., kBabyLepton)
+BABY_BRANCH  (Float_t, mz_fo_ctf_,       "mz_fo_ctf",       -999., kBabyLepton)
+BABY_BRANCH  (Float_t, mz_ctf_iso_,      "mz_ctf_iso",      -999., kBabyLepton)
+BABY_BRANCH  (Float_t, mupsilon_fo_mu_,  "mupsilon_fo_mu",  -999., kBabyLepton)
+BABY_BRANCH  (Float_t, mupsilon_mu_iso_, "mupsilon_mu_iso", -999., kBabyLepton)
+
+BABY_BRANCH  (Bool_t, mu_isCosmic_, "mu_isCosmic", false, kBabyLepton)
+
+BABY_BRANCH  (Float_t, mu_ecal_veto_dep_, "mu_ecal_veto_dep", -999., kBabyLepton)
+BABY_BRANCH  (Float_t, mu_hcal_veto_dep_, "mu_hcal_veto_dep", -999., kBabyLepton)
+BABY_BRANCH  (Float_t, mu_nchi2_,         "mu_nchi2",         -999., kBabyLepton)
+
+// Conversion Rejection
+BABY_BRANCH  (Bool_t, convHitPattern_,   "convHitPattern",   false, kBabyLepton) // isFromConversionHitPattern(iEl)
+BABY_BRANCH  (Bool_t, convPartnerTrack_, "convPartnerTrack", false, kBabyLepton) // isFromConversionPartnerTrack(iEl)
+BABY_BRANCH  (Bool_t, convMIT_,          "convMIT",          false, kBabyLepton) // isFromConversionMIT(iEl)
+BABY_BRANCH  (Bool_t, conv0MissHits_,    "conv0MissHits",    false, kBabyLepton) // true if els_exp_innerlayers().at(index) == 0
+
+// HT
+#ifndef __CMS2_SLIM__
+BABY_BRANCH  (float, ht_calo_,      "ht_calo",      -999, kBabyJets)
+BABY_BRANCH  (float, ht_calo_L2L3_, "ht_calo_L2L3", -999, kBabyJets)
+#endif
+BABY_BRANCH  (float, ht_pf_,            "ht_pf",            -999, kBabyJets)
+BABY_BRANCH  (float, ht_pf_L2L3_,       "ht_pf_L2L3",       -999, kBabyJets)
+BABY_BRANCH  (float, ht_pf_L1FastL2L3_, "ht_pf_L1FastL2L3", -999, kBabyJets)
+
+// MC truth information
+BABY_BRANCH  (Int_t,         mcid_,          "mcid",          0,                      kBabyMCTruth) // els_mc_id or mus_mc_id
+BABY_BRANCH  (Int_t,         mcmotherid_,    "mcmotherid",    0,                      kBabyMCTruth) // els_mc_motherid or mus_mc_motherid
+BABY_BRANCH  (Int_t,         mc3id_,         "mc3id",         -999,                   kBabyMCTruth)
+BABY_BRANCH  (Float_t,       mc3pt_,         "mc3pt",         -999.,                  kBabyMCTruth)
+BABY_BRANCH  (Float_t,       mc3dr_,         "mc3dr",         -999.,                  kBabyMCTruth)
+BABY_BRANCH  (LorentzVector, mc3p4_,         "mc3p4",         LorentzVector(0,0,0,0), kBabyMCTruth)
+BABY_BRANCH  (Int_t,         leptonIsFromW_, "leptonIsFromW", -999,                   kBabyMCTruth)
+
+//////////////////////////
+// End Lepton Variables //
+//////////////////////////
+
+//////////////////////////////////////////////////////
+// Fake Rate Numerator & Denominator Selections     //
+//////////////////////////////////////////////////////
+
+//////////
+// 2012 //
+//////////
+
+// SS
+
+// Electrons
+BABY_FLAG    (num_el_ssV7_,       "num_el_ssV7",       kBabySelections2012)
+BABY_FLAG    (num_el_ssV7_noIso_, "num_el_ssV7_noIso", kBabySelections2012)
+BABY_FLAG    (v1_el_ssV7_,        "v1_el_ssV7",        kBabySelections2012)
+BABY_FLAG    (v2_el_ssV7_,        "v2_el_ssV7",        kBabySelections2012)
+BABY_FLAG    (v3_el_ssV7_,        "v3_el_ssV7",        kBabySelections2012)
+
+// Muons
+BABY_FLAG    (num_mu_ssV5_,       "num_mu_ssV5",       kBabySelections2012) // NominalSSv5
+BABY_FLAG    (num_mu_ssV5_noIso_, "num_mu_ssV5_noIso", kBabySelections2012) // NominalSSv5 with no isolation applied
+BABY_FLAG    (fo_mu_ssV5_,        "fo_mu_ssV5",        kBabySelections2012) // muonSelectionFO_mu_ssV5
+BABY_FLAG    (fo_mu_ssV5_noIso_,  "fo_mu_ssV5_noIso",  kBabySelections2012) // muonSleectionFO_mu_ssV5 with no isolation applied
+
+// TTZ
+
+// Electrons
+BABY_FLAG    (num_el_TTZcuttightv1_,       "num_el_TTZcuttightv1",       kBabySelections2012)
+BABY_FLAG    (num_el_TTZcuttightv1_noIso_, "num_el_TTZcuttightv1_noIso", kBabySelections2012)
+BABY_FLAG    (fo_el_TTZcuttightv1_,        "fo_el_TTZcuttightv1",        kBabySelections2012)
+BABY_FLAG    (fo_el_TTZcuttightv1_noIso_,  "fo_el_TTZcuttightv1_noIso",  kBabySelections2012)
+
+BABY_FLAG    (num_el_TTZcutloosev1_,       "num_el_TTZcutloosev1",       kBabySelections2012)
+BABY_FLAG    (num_el_TTZcutloosev1_noIso_, "num_el_TTZcutloosev1_noIso", kBabySelections2012)
+BABY_FLAG    (fo_el_TTZcutloosev1_,        "fo_el_TTZcutloosev1",        kBabySelections2012)
+BABY_FLAG    (fo_el_TTZcutloosev1_noIso_,  "fo_el_TTZcutloosev1_noIso",  kBabySelections2012)
+
+BABY_FLAG    (num_el_TTZMVAtightv1_,       "num_el_TTZMVAtightv1",       kBabySelections2012)
+BABY_FLAG    (num_el_TTZMVAtightv1_noIso_, "num_el_TTZMVAtightv1_noIso", kBabySelections2012)
+BABY_FLAG    (fo_el_TTZMVAtightv1_,        "fo_el_TTZMVAtightv1",        kBabySelections2012)
+BABY_FLAG    (fo_el_TTZMVAtightv1_noIso_,  "fo_el_TTZMVAtightv1_noIso",  kBabySelections2012)
+
+BABY_FLAG    (num_el_TTZMVAloosev1_,       "num_el_TTZMVAloosev1",       kBabySelections2012)
+BABY_FLAG    (num_el_TTZMVAloosev1_noIso_, "num_el_TTZMVAloosev1_noIso", kBabySelections2012)
+BABY_FLAG    (fo_el_TTZMVAloosev1_,        "fo_el_TTZMVAloosev1",        kBabySelections2012)
+BABY_FLAG    (fo_el_TTZMVAloosev1_noIso_,  "fo_el_TTZMVAloosev1_noIso",  kBabySelections2012)
+
+// Muons
+BABY_FLAG    (num_mu_TTZtightv1_,       "num_mu_TTZtightv1",       kBabySelections2012)
+BABY_FLAG    (num_mu_TTZtightv1_noIso_, "num_mu_TTZtightv1_noIso", kBabySelections2012)
+BABY_FLAG    (fo_mu_TTZtightv1_,        "fo_mu_TTZtightv1",        kBabySelections2012)
+BABY_FLAG    (fo_mu_TTZtightv1_noIso_,  "fo_mu_TTZtightv1_noIso",  kBabySelections2012)
+
+BABY_FLAG    (num_mu_TTZloosev1_,       "num_mu_TTZloosev1",       kBabySelections2012)
+BABY_FLAG    (num_mu_TTZloosev1_noIso_, "num_mu_TTZloosev1_noIso", kBabySelections2012)
+BABY_FLAG    (fo_mu_TTZloosev1_,        "fo_mu_TTZloosev1",        kBabySelections2012)
+BABY_FLAG    (fo_mu_TTZloosev1_noIso_,  "fo_mu_TTZloosev1_noIso",  kBabySelections2012)
+
+
+//////////
+// 2011 //
+//////////
+
+// SS
+
+// Electrons
+BABY_FLAG    (num_el_ssV6_,       "num_el_ssV6",       kBabySelections2011)
+BABY_FLAG    (v1_el_ssV6_,        "v1_el_ssV6",        kBabySelections2011)
+BABY_FLAG    (v2_el_ssV6_,        "v2_el_ssV6",        kBabySelections2011)
+BABY_FLAG    (v3_el_ssV6_,        "v3_el_ssV6",        kBabySelections2011)
+BABY_FLAG    (num_el_ssV6_noIso_, "num_el_ssV6_noIso", kBabySelections2011)
+
+// Muons
+BABY_FLAG    (numNomSSv4_,      "numNomSSv4",      kBabySelections2011) // NominalSSv4
+BABY_FLAG    (fo_mussV4_04_,    "fo_mussV4_04",    kBabySelections2011) // muonSelectionFO_mu_ssV4
+BABY_FLAG    (numNomSSv4noIso_, "numNomSSv4noIso", kBabySelections2011) // NominalSSv4 with no isolation applied
+BABY_FLAG    (fo_mussV4_noIso_, "fo_mussV4_noIso", kBabySelections2011) // muonSleectionFO_mu_ssV4 with no isolation applied
+
+// WW, HWW
+
+// Electrons
+BABY_FLAG    (num_el_smurfV6_,   "num_el_smurfV6",   kBabySelections2011)
+BABY_FLAG    (num_el_smurfV6lh_, "num_el_smurfV6lh", kBabySelections2011)
+BABY_FLAG    (v1_el_smurfV1_,    "v1_el_smurfV1",    kBabySelections2011)
+BABY_FLAG    (v2_el_smurfV1_,    "v2_el_smurfV1",    kBabySelections2011)
+BABY_FLAG    (v3_el_smurfV1_,    "v3_el_smurfV1",    kBabySelections2011)
+BABY_FLAG    (v4_el_smurfV1_,    "v4_el_smurfV1",    kBabySelections2011)
+
+// Muons
+BABY_FLAG    (num_mu_smurfV6_, "num_mu_smurfV6", kBabySelections2011)
+BABY_FLAG    (fo_mu_smurf_04_, "fo_mu_smurf_04", kBabySelections2011)
+BABY_FLAG    (fo_mu_smurf_10_, "fo_mu_smurf_10", kBabySelections2011)
+
+
+// OS
+BABY_FLAG    (num_el_OSV2_,  "num_el_OSV2",  kBabySelections2011) // electronSelection_el_OSV2
+BABY_FLAG    (num_mu_OSGV2_, "num_mu_OSGV2", kBabySelections2011) // OSGeneric_v2
+BABY_FLAG    (num_mu_OSZV2_, "num_mu_OSZV2", kBabySelections2011) // OSZ_v2
+BABY_FLAG    (fo_el_OSV2_,   "fo_el_OSV2",   kBabySelections2011) // electronSelection_el_OSV2_FO
+BABY_FLAG    (fo_mu_OSGV2_,  "fo_mu_OSGV2",  kBabySelections2011) // OSGeneric_v2_FO
+
+BABY_FLAG    (num_el_OSV3_,  "num_el_OSV3",  kBabySelections2011) // electronSelection_el_OSV3
+BABY_FLAG    (num_mu_OSGV3_, "num_mu_OSGV3", kBabySelections2011) // OSGeneric_v3
+BABY_FLAG    (fo_el_OSV3_,   "fo_el_OSV3",   kBabySelections2011) // electronSelection_el_OSV3_FO
+BABY_FLAG    (fo_mu_OSGV3_,  "fo_mu_OSGV3",  kBabySelections2011) // OSGeneric_v3_FO
+
+//////////////////////////////////////////////////////
+// End Fake Rate Numerator & Denominator Selections //
+//////////////////////////////////////////////////////
+
+///////////////////////
+// 2012 Triggers     //
+///////////////////////
+
+// Electrons
+BABY_BRANCH  (Int_t, ele8_CaloIdL_CaloIsoVL_vstar_,                                "ele8_CaloIdL_CaloIsoVL_vstar",                                0, kBabyTriggers2012) // HLT_Ele8_CaloIdL_CaloIsoVL_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_,               "ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar",               0, kBabyTriggers2012) // HLT_Ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_,         "ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar",         0, kBabyTriggers2012) // HLT_Ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdT_TrkIdVL_vstar_,                                  "ele8_CaloIdT_TrkIdVL_vstar",                                  0, kBabyTriggers2012) // HLT_Ele8_CaloIdT_TrkIdVL_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdT_TrkIdVL_Jet30_vstar_,                            "ele8_CaloIdT_TrkIdVL_Jet30_vstar",                            0, kBabyTriggers2012) // HLT_Ele8_CaloIdT_TrkIdVL_Jet30_v*
+BABY_BRANCH  (Int_t, ele17_CaloIdL_CaloIsoVL_vstar_,                               "ele17_CaloIdL_CaloIsoVL_vstar",                               0, kBabyTriggers2012) // HLT_Ele17_CaloIdL_CaloIsoVL_v*
+BABY_BRANCH  (Int_t, ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_,              "ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar",              0, kBabyTriggers2012) // HLT_Ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_,        "ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar",        0, kBabyTriggers2012) // HLT_Ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_v*
+BABY_BRANCH  (Int_t, ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_, "ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar", 0, kBabyTriggers2012) // HLT_Ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_v*
+BABY_BRANCH  (Int_t, ele27_WP80_vstar_,                                            "ele27_WP80_vstar",                                            0, kBabyTriggers2012) // HLT_Ele27_WP80_v*
+
+BABY_BRANCH  (Int_t, ele8_CaloIdL_CaloIsoVL_version_,                                "ele8_CaloIdL_CaloIsoVL_version",                                -1, kBabyTriggers2012) // HLT_Ele8_CaloIdL_CaloIsoVL_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_,               "ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version",               -1, kBabyTriggers2012) // HLT_Ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_,         "ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version",         -1, kBabyTriggers2012) // HLT_Ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdT_TrkIdVL_version_,                                  "ele8_CaloIdT_TrkIdVL_version",                                  -1, kBabyTriggers2012) // HLT_Ele8_CaloIdT_TrkIdVL_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdT_TrkIdVL_Jet30_version_,                            "ele8_CaloIdT_TrkIdVL_Jet30_version",                            -1, kBabyTriggers2012) // HLT_Ele8_CaloIdT_TrkIdVL_Jet30_v*
+BABY_BRANCH  (Int_t, ele17_CaloIdL_CaloIsoVL_version_,                               "ele17_CaloIdL_CaloIsoVL_version",                               -1, kBabyTriggers2012) // HLT_Ele17_CaloIdL_CaloIsoVL_v*
+BABY_BRANCH  (Int_t, ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_,              "ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version",              -1, kBabyTriggers2012) // HLT_Ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_,        "ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version",        -1, kBabyTriggers2012) // HLT_Ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_v*
+BABY_BRANCH  (Int_t, ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_version_, "ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_version", -1, kBabyTriggers2012) // HLT_Ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_v*
+BABY_BRANCH  (Int_t, ele27_WP80_version_,                                            "ele27_WP80_version",                                            -1, kBabyTriggers2012) // HLT_Ele27_WP80_v*
+
+BABY_BRANCH  (Float_t, dr_ele8_CaloIdL_CaloIsoVL_vstar_,                                "dr_ele8_CaloIdL_CaloIsoVL_vstar",                                99.0, kBabyTriggers2012) // HLT_Ele8_CaloIdL_CaloIsoVL_v*
+BABY_BRANCH  (Float_t, dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_,               "dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar",               99.0, kBabyTriggers2012) // HLT_Ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_v*
+BABY_BRANCH  (Float_t, dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_,         "dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar",         99.0, kBabyTriggers2012) // HLT_Ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_v*
+BABY_BRANCH  (Float_t, dr_ele8_CaloIdT_TrkIdVL_vstar_,                                  "dr_ele8_CaloIdT_TrkIdVL_vstar",                                  99.0, kBabyTriggers2012) // HLT_Ele8_CaloIdT_TrkIdVL_v*
+BABY_BRANCH  (Float_t, dr_ele8_CaloIdT_TrkIdVL_Jet30_vstar_,                            "dr_ele8_CaloIdT_TrkIdVL_Jet30_vstar",                            99.0, kBabyTriggers2012) // HLT_Ele8_CaloIdT_TrkIdVL_Jet30_v*
+BABY_BRANCH  (Float_t, dr_ele17_CaloIdL_CaloIsoVL_vstar_,                               "dr_ele17_CaloIdL_CaloIsoVL_vstar",                               99.0, kBabyTriggers2012) // HLT_Ele17_CaloIdL_CaloIsoVL_v*
+BABY_BRANCH  (Float_t, dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_,              "dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar",              99.0, kBabyTriggers2012) // HLT_Ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_v*
+BABY_BRANCH  (Float_t, dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_,        "dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar",        99.0, kBabyTriggers2012) // HLT_Ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_v*
+BABY_BRANCH  (Float_t, dr_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_, "dr_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar", 99.0, kBabyTriggers2012) // HLT_Ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_v*
+BABY_BRANCH  (Float_t, dr_ele27_WP80_vstar_,                                            "dr_ele27_WP80_vstar",                                            99.0, kBabyTriggers2012) // HLT_Ele27_WP80_v*
+
+BABY_BRANCH  (Int_t, hltps_ele8_CaloIdL_CaloIsoVL_vstar_,                                "hltps_ele8_CaloIdL_CaloIsoVL_vstar",                                -1, kBabyTriggers2012) // HLT_Ele8_CaloIdL_CaloIsoVL_v*
+BABY_BRANCH  (Int_t, hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_,               "hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar",               -1, kBabyTriggers2012) // HLT_Ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_,         "hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar",         -1, kBabyTriggers2012) // HLT_Ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_v*
+BABY_BRANCH  (Int_t, hltps_ele8_CaloIdT_TrkIdVL_vstar_,                                  "hltps_ele8_CaloIdT_TrkIdVL_vstar",                                  -1, kBabyTriggers2012) // HLT_Ele8_CaloIdT_TrkIdVL_v*
+BABY_BRANCH  (Int_t, hltps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_,                            "hltps_ele8_CaloIdT_TrkIdVL_Jet30_vstar",                            -1, kBabyTriggers2012) // HLT_Ele8_CaloIdT_TrkIdVL_Jet30_v*
+BABY_BRANCH  (Int_t, hltps_ele17_CaloIdL_CaloIsoVL_vstar_,                               "hltps_ele17_CaloIdL_CaloIsoVL_vstar",                               -1, kBabyTriggers2012) // HLT_Ele17_CaloIdL_CaloIsoVL_v*
+BABY_BRANCH  (Int_t, hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_,              "hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar",              -1, kBabyTriggers2012) // HLT_Ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_,        "hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar",        -1, kBabyTriggers2012) // HLT_Ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_v*
+BABY_BRANCH  (Int_t, hltps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_, "hltps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar", -1, kBabyTriggers2012) // HLT_Ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_v*
+BABY_BRANCH  (Int_t, hltps_ele27_WP80_vstar_,                                            "hltps_ele27_WP80_vstar",                                            -1, kBabyTriggers2012) // HLT_Ele27_WP80_v*
+
+#ifndef __CMS2_SLIM__
+BABY_BRANCH  (Int_t, l1ps_ele8_CaloIdL_CaloIsoVL_vstar_,                                "l1ps_ele8_CaloIdL_CaloIsoVL_vstar",                                -1, kBabyTriggers2012) // L1_Ele8_CaloIdL_CaloIsoVL_v*
+BABY_BRANCH  (Int_t, l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_,               "l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar",               -1, kBabyTriggers2012) // L1_Ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_,         "l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar",         -1, kBabyTriggers2012) // L1_Ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_v*
+BABY_BRANCH  (Int_t, l1ps_ele8_CaloIdT_TrkIdVL_vstar_,                                  "l1ps_ele8_CaloIdT_TrkIdVL_vstar",                                  -1, kBabyTriggers2012) // L1_Ele8_CaloIdT_TrkIdVL_v*
+BABY_BRANCH  (Int_t, l1ps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_,                            "l1ps_ele8_CaloIdT_TrkIdVL_Jet30_vstar",                            -1, kBabyTriggers2012) // L1_Ele8_CaloIdT_TrkIdVL_Jet30_v*
+BABY_BRANCH  (Int_t, l1ps_ele17_CaloIdL_CaloIsoVL_vstar_,                               "l1ps_ele17_CaloIdL_CaloIsoVL_vstar",                               -1, kBabyTriggers2012) // L1_Ele17_CaloIdL_CaloIsoVL_v*
+BABY_BRANCH  (Int_t, l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_,              "l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar",              -1, kBabyTriggers2012) // L1_Ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_,        "l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar",        -1, kBabyTriggers2012) // L1_Ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_v*
+BABY_BRANCH  (Int_t, l1ps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_, "l1ps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar", -1, kBabyTriggers2012) // L1_Ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_v*
+BABY_BRANCH  (Int_t, l1ps_ele27_WP80_vstar_,                                            "l1ps_ele27_WP80_vstar",                                            -1, kBabyTriggers2012) // L1_Ele27_WP80_v*
+#endif
+
+// Muons
+BABY_BRANCH  (Int_t, mu5_vstar_,            "mu5_vstar",            0, kBabyTriggers2012) // HLT_Mu5_v*            // also in 2011
+BABY_BRANCH  (Int_t, mu8_vstar_,            "mu8_vstar",            0, kBabyTriggers2012) // HLT_Mu8_v*            // also in 2011
+BABY_BRANCH  (Int_t, mu12_vstar_,           "mu12_vstar",           0, kBabyTriggers2012) // HLT_Mu12_v*           // also in 2011
+BABY_BRANCH  (Int_t, mu17_vstar_,           "mu17_vstar",           0, kBabyTriggers2012) // HLT_Mu17_v*
+BABY_BRANCH  (Int_t, mu15_eta2p1_vstar_,    "mu15_eta2p1_vstar",    0, kBabyTriggers2012) // HLT_Mu15_eta2p1_v*
+BABY_BRANCH  (Int_t, mu24_eta2p1_vstar_,    "mu24_eta2p1_vstar",    0, kBabyTriggers2012) // HLT_Mu24_eta2p1_v*
+BABY_BRANCH  (Int_t, mu30_eta2p1_vstar_,    "mu30_eta2p1_vstar",    0, kBabyTriggers2012) // HLT_Mu30_eta2p1_v*
+BABY_BRANCH  (Int_t, isoMu20_eta2p1_vstar_, "isoMu20_eta2p1_vstar", 0, kBabyTriggers2012) // HLT_IsoMu20_eta2p1_v*
+BABY_BRANCH  (Int_t, isoMu24_eta2p1_vstar_, "isoMu24_eta2p1_vstar", 0, kBabyTriggers2012) // HLT_IsoMu24_eta2p1_v*
+BABY_BRANCH  (Int_t, isoMu30_eta2p1_vstar_, "isoMu30_eta2p1_vstar", 0, kBabyTriggers2012) // HLT_IsoMu30_eta2p1_v*
+BABY_BRANCH  (Int_t, relIso1p0Mu17_vstar_,  "relIso1p0Mu17_vstar",  0, kBabyTriggers2012) // HLT_RelIso1p0Mu17_v*
+BABY_BRANCH  (Int_t, relIso1p0Mu20_vstar_,  "relIso1p0Mu20_vstar",  0, kBabyTriggers2012) // HLT_RelIso1p0Mu20_v*
+BABY_BRANCH  (Int_t, relIso1p0Mu5_vstar_,   "relIso1p0Mu5_vstar",   0, kBabyTriggers2012) // HLT_RelIso1p0Mu5_v*
+
+BABY_BRANCH  (Int_t, mu5_version_,            "mu5_version",            -1, kBabyTriggers2012) // HLT_Mu5_v*            // also in 2011
+BABY_BRANCH  (Int_t, mu8_version_,            "mu8_version",            -1, kBabyTriggers2012) // HLT_Mu8_v*            // also in 2011
+BABY_BRANCH  (Int_t, mu12_version_,           "mu12_version",           -1, kBabyTriggers2012) // HLT_Mu12_v*           // also in 2011
+BABY_BRANCH  (Int_t, mu17_version_,           "mu17_version",           -1, kBabyTriggers2012) // HLT_Mu17_v*
+BABY_BRANCH  (Int_t, mu15_eta2p1_version_,    "mu15_eta2p1_version",    -1, kBabyTriggers2012) // HLT_Mu15_eta2p1_v*
+BABY_BRANCH  (Int_t, mu24_eta2p1_version_,    "mu24_eta2p1_version",    -1, kBabyTriggers2012) // HLT_Mu24_eta2p1_v*
+BABY_BRANCH  (Int_t, mu30_eta2p1_version_,    "mu30_eta2p1_version",    -1, kBabyTriggers2012) // HLT_Mu30_eta2p1_v*
+BABY_BRANCH  (Int_t, isoMu20_eta2p1_version_, "isoMu20_eta2p1_version", -1, kBabyTriggers2012) // HLT_IsoMu20_eta2p1_v*
+BABY_BRANCH  (Int_t, isoMu24_eta2p1_version_, "isoMu24_eta2p1_version", -1, kBabyTriggers2012) // HLT_IsoMu24_eta2p1_v*
+BABY_BRANCH  (Int_t, isoMu30_eta2p1_version_, "isoMu30_eta2p1_version", -1, kBabyTriggers2012) // HLT_IsoMu30_eta2p1_v*
+BABY_BRANCH  (Int_t, relIso1p0Mu17_version_,  "relIso1p0Mu17_version",  -1, kBabyTriggers2012) // HLT_RelIso1p0Mu17_v*
+BABY_BRANCH  (Int_t, relIso1p0Mu20_version_,  "relIso1p0Mu20_version",  -1, kBabyTriggers2012) // HLT_RelIso1p0Mu20_v*
+BABY_BRANCH  (Int_t, relIso1p0Mu5_version_,   "relIso1p0Mu5_version",   -1, kBabyTriggers2012) // HLT_RelIso1p0Mu5_v*
+
+BABY_BRANCH  (Float_t, dr_mu5_vstar_,            "dr_mu5_vstar",            99.0, kBabyTriggers2012) // HLT_Mu5_v*            // also in 2011
+BABY_BRANCH  (Float_t, dr_mu8_vstar_,            "dr_mu8_vstar",            99.0, kBabyTriggers2012) // HLT_Mu8_v*            // also in 2011
+BABY_BRANCH  (Float_t, dr_mu12_vstar_,           "dr_mu12_vstar",           99.0, kBabyTriggers2012) // HLT_Mu12_v*           // also in 2011
+BABY_BRANCH  (Float_t, dr_mu17_vstar_,           "dr_mu17_vstar",           99.0, kBabyTriggers2012) // HLT_Mu17_v*
+BABY_BRANCH  (Float_t, dr_mu15_eta2p1_vstar_,    "dr_mu15_eta2p1_vstar",    99.0, kBabyTriggers2012) // HLT_Mu15_eta2p1_v*
+BABY_BRANCH  (Float_t, dr_mu24_eta2p1_vstar_,    "dr_mu24_eta2p1_vstar",    99.0, kBabyTriggers2012) // HLT_Mu24_eta2p1_v*
+BABY_BRANCH  (Float_t, dr_mu30_eta2p1_vstar_,    "dr_mu30_eta2p1_vstar",    99.0, kBabyTriggers2012) // HLT_Mu30_eta2p1_v*
+BABY_BRANCH  (Float_t, dr_isoMu20_eta2p1_vstar_, "dr_isoMu20_eta2p1_vstar", 99.0, kBabyTriggers2012) // HLT_IsoMu20_eta2p1_v*
+BABY_BRANCH  (Float_t, dr_isoMu24_eta2p1_vstar_, "dr_isoMu24_eta2p1_vstar", 99.0, kBabyTriggers2012) // HLT_IsoMu24_eta2p1_v*
+BABY_BRANCH  (Float_t, dr_isoMu30_eta2p1_vstar_, "dr_isoMu30_eta2p1_vstar", 99.0, kBabyTriggers2012) // HLT_IsoMu30_eta2p1_v*
+BABY_BRANCH  (Float_t, dr_relIso1p0Mu17_vstar_,  "dr_relIso1p0Mu17_vstar",  99.0, kBabyTriggers2012) // HLT_RelIso1p0Mu17_v*
+BABY_BRANCH  (Float_t, dr_relIso1p0Mu20_vstar_,  "dr_relIso1p0Mu20_vstar",  99.0, kBabyTriggers2012) // HLT_RelIso1p0Mu20_v*
+BABY_BRANCH  (Float_t, dr_relIso1p0Mu5_vstar_,   "dr_relIso1p0Mu5_vstar",   99.0, kBabyTriggers2012) // HLT_RelIso1p0Mu5_v*
+
+BABY_BRANCH  (Int_t, hltps_mu5_vstar_,            "hltps_mu5_vstar",            -1, kBabyTriggers2012) // HLT_Mu5_v*            // also in 2011
+BABY_BRANCH  (Int_t, hltps_mu8_vstar_,            "hltps_mu8_vstar",            -1, kBabyTriggers2012) // HLT_Mu8_v*            // also in 2011
+BABY_BRANCH  (Int_t, hltps_mu12_vstar_,           "hltps_mu12_vstar",           -1, kBabyTriggers2012) // HLT_Mu12_v*           // also in 2011
+BABY_BRANCH  (Int_t, hltps_mu17_vstar_,           "hltps_mu17_vstar",           -1, kBabyTriggers2012) // HLT_Mu17_v*
+BABY_BRANCH  (Int_t, hltps_mu15_eta2p1_vstar_,    "hltps_mu15_eta2p1_vstar",    -1, kBabyTriggers2012) // HLT_Mu15_eta2p1_v*
+BABY_BRANCH  (Int_t, hltps_mu24_eta2p1_vstar_,    "hltps_mu24_eta2p1_vstar",    -1, kBabyTriggers2012) // HLT_Mu24_eta2p1_v*
+BABY_BRANCH  (Int_t, hltps_mu30_eta2p1_vstar_,    "hltps_mu30_eta2p1_vstar",    -1, kBabyTriggers2012) // HLT_Mu30_eta2p1_v*
+BABY_BRANCH  (Int_t, hltps_isoMu20_eta2p1_vstar_, "hltps_isoMu20_eta2p1_vstar", -1, kBabyTriggers2012) // HLT_IsoMu20_eta2p1_v*
+BABY_BRANCH  (Int_t, hltps_isoMu24_eta2p1_vstar_, "hltps_isoMu24_eta2p1_vstar", -1, kBabyTriggers2012) // HLT_IsoMu24_eta2p1_v*
+BABY_BRANCH  (Int_t, hltps_isoMu30_eta2p1_vstar_, "hltps_isoMu30_eta2p1_vstar", -1, kBabyTriggers2012) // HLT_IsoMu30_eta2p1_v*
+BABY_BRANCH  (Int_t, hltps_relIso1p0Mu17_vstar_,  "hltps_relIso1p0Mu17_vstar",  -1, kBabyTriggers2012) // HLT_RelIso1p0Mu17_v*
+BABY_BRANCH  (Int_t, hltps_relIso1p0Mu20_vstar_,  "hltps_relIso1p0Mu20_vstar",  -1, kBabyTriggers2012) // HLT_RelIso1p0Mu20_v*
+BABY_BRANCH  (Int_t, hltps_relIso1p0Mu5_vstar_,   "hltps_relIso1p0Mu5_vstar",   -1, kBabyTriggers2012) // HLT_RelIso1p0Mu5_v*
+
+#ifndef __CMS2_SLIM__
+BABY_BRANCH  (Int_t, l1ps_mu5_vstar_,            "l1ps_mu5_vstar",            -1, kBabyTriggers2012) // HLT_Mu5_v*            // also in 2011
+BABY_BRANCH  (Int_t, l1ps_mu8_vstar_,            "l1ps_mu8_vstar",            -1, kBabyTriggers2012) // HLT_Mu8_v*            // also in 2011
+BABY_BRANCH  (Int_t, l1ps_mu12_vstar_,           "l1ps_mu12_vstar",           -1, kBabyTriggers2012) // HLT_Mu12_v*           // also in 2011
+BABY_BRANCH  (Int_t, l1ps_mu17_vstar_,           "l1ps_mu17_vstar",           -1, kBabyTriggers2012) // HLT_Mu17_v*
+BABY_BRANCH  (Int_t, l1ps_mu15_eta2p1_vstar_,    "l1ps_mu15_eta2p1_vstar",    -1, kBabyTriggers2012) // HLT_Mu15_eta2p1_v*
+BABY_BRANCH  (Int_t, l1ps_mu24_eta2p1_vstar_,    "l1ps_mu24_eta2p1_vstar",    -1, kBabyTriggers2012) // HLT_Mu24_eta2p1_v*
+BABY_BRANCH  (Int_t, l1ps_mu30_eta2p1_vstar_,    "l1ps_mu30_eta2p1_vstar",    -1, kBabyTriggers2012) // HLT_Mu30_eta2p1_v*
+BABY_BRANCH  (Int_t, l1ps_isoMu20_eta2p1_vstar_, "l1ps_isoMu20_eta2p1_vstar", -1, kBabyTriggers2012) // HLT_IsoMu20_eta2p1_v*
+BABY_BRANCH  (Int_t, l1ps_isoMu24_eta2p1_vstar_, "l1ps_isoMu24_eta2p1_vstar", -1, kBabyTriggers2012) // HLT_IsoMu24_eta2p1_v*
+BABY_BRANCH  (Int_t, l1ps_isoMu30_eta2p1_vstar_, "l1ps_isoMu30_eta2p1_vstar", -1, kBabyTriggers2012) // HLT_IsoMu30_eta2p1_v*
+BABY_BRANCH  (Int_t, l1ps_relIso1p0Mu17_vstar_,  "l1ps_relIso1p0Mu17_vstar",  -1, kBabyTriggers2012) // HLT_RelIso1p0Mu17_v*
+BABY_BRANCH  (Int_t, l1ps_relIso1p0Mu5_vstar_,   "l1ps_relIso1p0Mu5_vstar",   -1, kBabyTriggers2012) // HLT_RelIso1p0Mu5_v*
+#endif
+
+// the triggers in the compact trigger block (see myBabyMaker::SetCompactTriggers)
+BABY_TRIGGER (ele8_CaloIdL_CaloIsoVL,                                kBabyTriggers2012)
+BABY_TRIGGER (ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL,               kBabyTriggers2012)
+BABY_TRIGGER (ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30,         kBabyTriggers2012)
+BABY_TRIGGER (ele8_CaloIdT_TrkIdVL,                                  kBabyTriggers2012)
+BABY_TRIGGER (ele8_CaloIdT_TrkIdVL_Jet30,                            kBabyTriggers2012)
+BABY_TRIGGER (ele17_CaloIdL_CaloIsoVL,                               kBabyTriggers2012)
+BABY_TRIGGER (ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL,              kBabyTriggers2012)
+BABY_TRIGGER (ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30,        kBabyTriggers2012)
+BABY_TRIGGER (ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30, kBabyTriggers2012)
+BABY_TRIGGER (ele27_WP80,                                            kBabyTriggers2012)
+BABY_TRIGGER (mu5,                                                   kBabyTriggers2012)
+BABY_TRIGGER (mu8,                                                   kBabyTriggers2012)
+BABY_TRIGGER (mu12,                                                  kBabyTriggers2012)
+BABY_TRIGGER (mu17,                                                  kBabyTriggers2012)
+BABY_TRIGGER (mu15_eta2p1,                                           kBabyTriggers2012)
+BABY_TRIGGER (mu24_eta2p1,                                           kBabyTriggers2012)
+BABY_TRIGGER (mu30_eta2p1,                                           kBabyTriggers2012)
+BABY_TRIGGER (isoMu20_eta2p1,                                        kBabyTriggers2012)
+BABY_TRIGGER (isoMu24_eta2p1,                                        kBabyTriggers2012)
+BABY_TRIGGER (isoMu30_eta2p1,                                        kBabyTriggers2012)
+BABY_TRIGGER (relIso1p0Mu17,                                         kBabyTriggers2012)
+BABY_TRIGGER (relIso1p0Mu20,                                         kBabyTriggers2012)
+BABY_TRIGGER (relIso1p0Mu5,                                          kBabyTriggers2012)
+
+///////////////////////
+// End 2012 Triggers //
+///////////////////////
+
+
+///////////////////////
+// 2011 Triggers     //
+///////////////////////
+
+// Triggers & HLT matching
+// 0  = fail
+// 1  = "pass but no match"
+// 2  = "pass and matched"
+// -1 = "pass but egamm trg obj missing"
+
+// 2011 Trigger Documenation Rules
+//
+//  1. The trigger variable name = the trigger name with:
+//      "HLT_Ele" -> "ele"  (electrons)
+//      "HLT_Mu"  -> "mu"   (muons)
+//  2. Each trigger variable name should be commented with the trigger name
+//  3. Delta R to the closest trigger object should be stored for each trigger by prepending "dr_" to the trigger variable name
+//  4. HLT prescale of the trigger object whould be stored for each trigger by prepending "hltps_" to the trigger variable name
+//  4. L1 prescale of the trigger object whould be stored for each trigger by prepending "l1ps_" to the trigger variable name
+
+// Electrons
+BABY_BRANCH  (Int_t, ele8_vstar_,                                          "ele8_vstar",                                          0, kBabyTriggers2011) // HLT_Ele8_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdL_TrkIdVL_vstar_,                          "ele8_CaloIdL_TrkIdVL_vstar",                          0, kBabyTriggers2011) // HLT_Ele8_CaloIdL_TrkIdVL_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdL_CaloIsoVL_Jet40_vstar_,                  "ele8_CaloIdL_CaloIsoVL_Jet40_vstar",                  0, kBabyTriggers2011) // HLT_Ele8_CaloIdL_CaloIsoVL_Jet40_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_,       "ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar",       0, kBabyTriggers2011) // HLT_Ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_, "photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar", 0, kBabyTriggers2011) // HLT_Photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_v*
+
+BABY_BRANCH  (Int_t, ele8_version_,                                          "ele8_version",                                          -1, kBabyTriggers2011) // HLT_Ele8_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdL_TrkIdVL_version_,                          "ele8_CaloIdL_TrkIdVL_version",                          -1, kBabyTriggers2011) // HLT_Ele8_CaloIdL_TrkIdVL_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdL_CaloIsoVL_Jet40_version_,                  "ele8_CaloIdL_CaloIsoVL_Jet40_version",                  -1, kBabyTriggers2011) // HLT_Ele8_CaloIdL_CaloIsoVL_Jet40_v*
+BABY_BRANCH  (Int_t, ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_version_,       "ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_version",       -1, kBabyTriggers2011) // HLT_Ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_version_, "photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_version", -1, kBabyTriggers2011) // HLT_Photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_v*
+
+BABY_BRANCH  (Float_t, dr_ele8_vstar_,                                          "dr_ele8_vstar",                                          99.0, kBabyTriggers2011) // HLT_Ele8_v*
+BABY_BRANCH  (Float_t, dr_ele8_CaloIdL_TrkIdVL_vstar_,                          "dr_ele8_CaloIdL_TrkIdVL_vstar",                          99.0, kBabyTriggers2011) // HLT_Ele8_CaloIdL_TrkIdVL_v*
+BABY_BRANCH  (Float_t, dr_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_,                  "dr_ele8_CaloIdL_CaloIsoVL_Jet40_vstar",                  99.0, kBabyTriggers2011) // HLT_Ele8_CaloIdL_CaloIsoVL_Jet40_v*
+BABY_BRANCH  (Float_t, dr_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_,       "dr_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar",       99.0, kBabyTriggers2011) // HLT_Ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_v*
+BABY_BRANCH  (Float_t, dr_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_, "dr_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar", 99.0, kBabyTriggers2011) // HLT_Photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_v*
+
+BABY_BRANCH  (Int_t, hltps_ele8_vstar_,                                          "hltps_ele8_vstar",                                          -1, kBabyTriggers2011) // HLT_Ele8_v*
+BABY_BRANCH  (Int_t, hltps_ele8_CaloIdL_TrkIdVL_vstar_,                          "hltps_ele8_CaloIdL_TrkIdVL_vstar",                          -1, kBabyTriggers2011) // HLT_Ele8_CaloIdL_TrkIdVL_v*
+BABY_BRANCH  (Int_t, hltps_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_,                  "hltps_ele8_CaloIdL_CaloIsoVL_Jet40_vstar",                  -1, kBabyTriggers2011) // HLT_Ele8_CaloIdL_CaloIsoVL_Jet40_v*
+BABY_BRANCH  (Int_t, hltps_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_,       "hltps_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar",       -1, kBabyTriggers2011) // HLT_Ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_v*
+BABY_BRANCH  (Int_t, hltps_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_, "hltps_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar", -1, kBabyTriggers2011) // HLT_Photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_v*
+
+// Muons
+BABY_BRANCH  (Int_t, mu3_vstar_,       "mu3_vstar",       0, kBabyTriggers2011) // HLT_Mu3_v*
+BABY_BRANCH  (Int_t, mu15_vstar_,      "mu15_vstar",      0, kBabyTriggers2011) // HLT_Mu15_v*
+BABY_BRANCH  (Int_t, mu20_vstar_,      "mu20_vstar",      0, kBabyTriggers2011) // HLT_Mu20_v*
+BABY_BRANCH  (Int_t, mu24_vstar_,      "mu24_vstar",      0, kBabyTriggers2011) // HLT_Mu24_v*
+BABY_BRANCH  (Int_t, mu30_vstar_,      "mu30_vstar",      0, kBabyTriggers2011) // HLT_Mu30_v*
+BABY_BRANCH  (Int_t, mu8_Jet40_vstar_, "mu8_Jet40_vstar", 0, kBabyTriggers2011) // HLT_Mu8_Jet40_v*
+
+BABY_BRANCH  (Int_t, mu3_version_,       "mu3_version",       -1, kBabyTriggers2011) // HLT_Mu3_v*
+BABY_BRANCH  (Int_t, mu15_version_,      "mu15_version",      -1, kBabyTriggers2011) // HLT_Mu15_v*
+BABY_BRANCH  (Int_t, mu20_version_,      "mu20_version",      -1, kBabyTriggers2011) // HLT_Mu20_v*
+BABY_BRANCH  (Int_t, mu24_version_,      "mu24_version",      -1, kBabyTriggers2011) // HLT_Mu24_v*
+BABY_BRANCH  (Int_t, mu30_version_,      "mu30_version",      -1, kBabyTriggers2011) // HLT_Mu30_v*
+BABY_BRANCH  (Int_t, mu8_Jet40_version_, "mu8_Jet40_version", -1, kBabyTriggers2011) // HLT_Mu8_Jet40_v*
+
+BABY_BRANCH  (Float_t, dr_mu3_vstar_,       "dr_mu3_vstar",       99.0, kBabyTriggers2011) // HLT_Mu5_v*
+BABY_BRANCH  (Float_t, dr_mu15_vstar_,      "dr_mu15_vstar",      99.0, kBabyTriggers2011) // HLT_Mu15_v*
+BABY_BRANCH  (Float_t, dr_mu20_vstar_,      "dr_mu20_vstar",      99.0, kBabyTriggers2011) // HLT_Mu20_v*
+BABY_BRANCH  (Float_t, dr_mu24_vstar_,      "dr_mu24_vstar",      99.0, kBabyTriggers2011) // HLT_Mu24_v*
+BABY_BRANCH  (Float_t, dr_mu30_vstar_,      "dr_mu30_vstar",      99.0, kBabyTriggers2011) // HLT_Mu30_v*
+BABY_BRANCH  (Float_t, dr_mu8_Jet40_vstar_, "dr_mu8_Jet40_vstar", 99.0, kBabyTriggers2011) // HLT_Mu8_Jet40_v*
+
+BABY_BRANCH  (Int_t, hltps_mu3_vstar_,       "hltps_mu3_vstar",       -1, kBabyTriggers2011) // HLT_Mu5_v*
+BABY_BRANCH  (Int_t, hltps_mu15_vstar_,      "hltps_mu15_vstar",      -1, kBabyTriggers2011) // HLT_Mu15_v*
+BABY_BRANCH  (Int_t, hltps_mu20_vstar_,      "hltps_mu20_vstar",      -1, kBabyTriggers2011) // HLT_Mu20_v*
+BABY_BRANCH  (Int_t, hltps_mu24_vstar_,      "hltps_mu24_vstar",      -1, kBabyTriggers2011) // HLT_Mu24_v*
+BABY_BRANCH  (Int_t, hltps_mu30_vstar_,      "hltps_mu30_vstar",      -1, kBabyTriggers2011) // HLT_Mu30_v*
+BABY_BRANCH  (Int_t, hltps_mu8_Jet40_vstar_, "hltps_mu8_Jet40_vstar", -1, kBabyTriggers2011) // HLT_Mu8_Jet40_v*
+
+// the triggers in the compact trigger block (see myBabyMaker::SetCompactTriggers)
+BABY_TRIGGER (ele8,                                          kBabyTriggers2011)
+BABY_TRIGGER (ele8_CaloIdL_TrkIdVL,                          kBabyTriggers2011)
+BABY_TRIGGER (ele8_CaloIdL_CaloIsoVL_Jet40,                  kBabyTriggers2011)
+BABY_TRIGGER (ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL,       kBabyTriggers2011)
+BABY_TRIGGER (photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL, kBabyTriggers2011)
+BABY_TRIGGER (mu3,                                           kBabyTriggers2011)
+BABY_TRIGGER (mu15,                                          kBabyTriggers2011)
+BABY_TRIGGER (mu20,                                          kBabyTriggers2011)
+BABY_TRIGGER (mu24,                                          kBabyTriggers2011)
+BABY_TRIGGER (mu30,                                          kBabyTriggers2011)
+BABY_TRIGGER (mu8_Jet40,                                     kBabyTriggers2011)
+
+///////////////////////
+// End 2011 Triggers //
+///////////////////////
+
+
+//////////////
+// Jets     //
+//////////////
+
+// Btag information
+#ifndef __CMS2_SLIM__
+BABY_BRANCH  (Int_t,   nbjet_,   "nbjet",  0,    kBabyJets) // number of btagged jet pt>15
+BABY_BRANCH  (Float_t, dRbNear_, "dRNear", 99.,  kBabyJets) // dR between lepton and closest such jet
+BABY_BRANCH  (Float_t, dRbFar_,  "dRFar",  -99., kBabyJets) // dR between lepton and farthest such jet
+#endif
+
+// Btag PF Corrected information
+BABY_BRANCH  (Int_t,   nbpfcjet_,   "nbpfcjet",  0,    kBabyJets) // number of btagged jet pt>15
+BABY_BRANCH  (Float_t, dRbpfcNear_, "dRpfcNear", 99.,  kBabyJets) // dR between lepton and closest such jet
+BABY_BRANCH  (Float_t, dRbpfcFar_,  "dRpfcFar",  -99., kBabyJets) // dR between lepton and farthest such jet
+
+#ifndef __CMS2_SLIM__
+// Information to do offline jet trigger selection
+BABY_BRANCH  (Float_t, ptj1_,       "ptj1",       0.,    kBabyJets) // highest pt jet well separated from the lepton
+BABY_BRANCH  (Float_t, ptj1_b2b_,   "ptj1_b2b",   -999., kBabyJets) // highest pt jet away frmo lepton by dR >= 1.0 and dPhi > 2.5
+BABY_BRANCH  (Float_t, dphij1_b2b_, "dphij1_b2b", -999., kBabyJets) // dphi between lepton and jet for jets away from lepton by dR >= 1.0
+BABY_BRANCH  (Int_t,   nj1_,        "nj1",        0,     kBabyJets) // number of jets above 10 GeV and away from lepton by dR >= 1.0
+#endif
+BABY_BRANCH  (Float_t, ptpfj1_,       "ptpfj1",       0.,    kBabyJets) // highest pt pfjet well separated from the lepton
+BABY_BRANCH  (Float_t, ptpfj1_b2b_,   "ptpfj1_b2b",   -999., kBabyJets) // highest pt pfjet away frmo lepton by dR >= 1.0 and dPhi > 2.5
+BABY_BRANCH  (Float_t, dphipfj1_b2b_, "dphipfj1_b2b", -999., kBabyJets) // dphi between lepton and pfjet for pfjets away from lepton by dR >= 1.0
+BABY_BRANCH  (Int_t,   npfj1_,        "npfj1",        0,     kBabyJets) // number of pfjets above 10 GeV and away from lepton by dR >= 1.0
+
+// Same for PF Corrected jets L2L3
+BABY_BRANCH  (Float_t, ptpfcj1_,       "ptpfcj1",       0.,    kBabyJets) // highest pt jet well separated from the lepton
+BABY_BRANCH  (Float_t, ptpfcj1_b2b_,   "ptpfcj1_b2b",   -999., kBabyJets) // highest pt jet away frmo lepton by dR >= 1.0 and dPhi > 2.5
+BABY_BRANCH  (Float_t, dphipfcj1_b2b_, "dphipfcj1_b2b", -999., kBabyJets) // dphi between lepton and jet for jets away from lepton by dR >= 1.0
+BABY_BRANCH  (Int_t,   npfcj1_,        "npfcj1",        0,     kBabyJets) // number of jets above 10 GeV and away from lepton by dR >= 1.0
+BABY_BRANCH  (Bool_t,  btagpfc_,       "btagpfc",       false, kBabyJets)
+
+// Same for PF Corrected jets L1FastL2L3
+BABY_BRANCH  (Float_t, emfpfcL1Fj1_,      "emfpfcL1Fj1",      -999., kBabyJets) // EMF of hight pt PF jet well separated from lepton
+BABY_BRANCH  (Float_t, ptpfcL1Fj1_,       "ptpfcL1Fj1",       0.,    kBabyJets) // highest pt jet well separated from the lepton
+BABY_BRANCH  (Float_t, dphipfcL1Fj1_,     "dphipfcL1Fj1",     -999., kBabyJets) // dphi between highest pt jet well separated from the lepton and lepton
+BABY_BRANCH  (Float_t, ptpfcL1Fj1_b2b_,   "ptpfcL1Fj1_b2b",   -999., kBabyJets) // highest pt jet away frmo lepton by dR >= 1.0 and dPhi > 2.5
+BABY_BRANCH  (Float_t, dphipfcL1Fj1_b2b_, "dphipfcL1Fj1_b2b", -999., kBabyJets) // dphi between lepton and jet for jets away from lepton by dR >= 1.0
+BABY_BRANCH  (Int_t,   npfcL1Fj1_,        "npfcL1Fj1",        0,     kBabyJets) // number of jets above 10 GeV and away from lepton by dR >= 1.0
+BABY_BRANCH  (Bool_t,  btagpfcL1F_,       "btagpfcL1F",       false, kBabyJets)
+BABY_BRANCH  (Int_t,   npfc30L1Fj1_,      "npfc30L1Fj1",      0,     kBabyJets) // number of jets above 30 GeV and away from lepton by dR >= 1.0
+BABY_BRANCH  (Int_t,   npfc40L1Fj1_,      "npfc40L1Fj1",      0,     kBabyJets) // number of jets above 40 GeV and away from lepton by dR >= 1.0
+BABY_BRANCH  (Int_t,   npfc50L1Fj1_eth_,  "npfc50L1Fj1_eth",  0,     kBabyJets) // number of jets above 50 GeV and away from lepton by dR >= 0.4
+BABY_BRANCH  (Int_t,   npfc65L1Fj1_eth_,  "npfc65L1Fj1_eth",  0,     kBabyJets) // number of jets above 65 GeV and away from lepton by dR >= 0.4
+BABY_BRANCH  (Int_t,   nbpfc40L1Fj1_,     "nbpfc40L1Fj1",     0,     kBabyJets) // number of jets above 40 GeV and away from lepton by dR >= 1.0
+
+// Same for btagged PF Corrected jets L1FastL2L3
+BABY_BRANCH  (Float_t, ptbtagpfcL1Fj1_,   "ptbtagpfcL1Fj1",   0.,    kBabyJets) // highest pt btagged jet well separated from the lepton
+BABY_BRANCH  (Float_t, dphibtagpfcL1Fj1_, "dphibtagpfcL1Fj1", -999., kBabyJets) // dphi between highest pt btagged jet well separated from the lepton and lepton
+
+// Same for PF Corrected jets L1FastL2L3Residual
+BABY_BRANCH  (Float_t, emfpfcL1Fj1res_,      "emfpfcL1Fj1res",      -999., kBabyJets) // EMF of hight pt PF jet well separated from lepton
+BABY_BRANCH  (Float_t, ptpfcL1Fj1res_,       "ptpfcL1Fj1res",       0.,    kBabyJets) // highest pt jet well separated from the lepton
+BABY_BRANCH  (Float_t, dphipfcL1Fj1res_,     "dphipfcL1Fj1res",     -999., kBabyJets) // dphi between highest pt jet well separated from the lepton and lepton
+BABY_BRANCH  (Float_t, ptpfcL1Fj1res_b2b_,   "ptpfcL1Fj1res_b2b",   -999., kBabyJets) // highest pt jet away frmo lepton by dR >= 1.0 and dPhi > 2.5
+BABY_BRANCH  (Float_t, dphipfcL1Fj1res_b2b_, "dphipfcL1Fj1res_b2b", -999., kBabyJets) // dphi between lepton and jet for jets away from lepton by dR >= 1.0
+BABY_BRANCH  (Int_t,   npfcL1Fj1res_,        "npfcL1Fj1res",        0,     kBabyJets) // number of jets above 10 GeV and away from lepton by dR >= 1.0
+BABY_BRANCH  (Bool_t,  btagpfcL1Fres_,       "btagpfcL1Fres",       false, kBabyJets)
+BABY_BRANCH  (Int_t,   npfc30L1Fj1res_,      "npfc30L1Fj1res",      0,     kBabyJets) // number of jets above 30 GeV and away from lepton by dR >= 1.0
+BABY_BRANCH  (Int_t,   npfc40L1Fj1res_,      "npfc40L1Fj1res",      0,     kBabyJets) // number of jets above 40 GeV and away from lepton by dR >= 1.0
+BABY_BRANCH  (Int_t,   npfc50L1Fj1res_eth_,  "npfc50L1Fj1res_eth",  0,     kBabyJets) // number of jets above 50 GeV and away from lepton by dR >= 0.4
+BABY_BRANCH  (Int_t,   npfc65L1Fj1res_eth_,  "npfc65L1Fj1res_eth",  0,     kBabyJets) // number of jets above 65 GeV and away from lepton by dR >= 0.4
+BABY_BRANCH  (Int_t,   nbpfc40L1Fj1res_,     "nbpfc40L1Fj1res",     0,     kBabyJets) // number of b-tagged jets above 40 GeV and away from lepton by dR >= 1.0
+
+// Same for btagged PF Corrected jets L1FastL2L3Residual
+BABY_BRANCH  (Float_t, ptbtagpfcL1Fj1res_,   "ptbtagpfcL1Fj1res",   0.,    kBabyJets) // highest pt btagged jet well separated from the lepton
+BABY_BRANCH  (Float_t, dphibtagpfcL1Fj1res_, "dphibtagpfcL1Fj1res", -999., kBabyJets) // dphi between highest pt btagged jet well separated from the lepton and lepton
+
+BABY_BRANCH  (Float_t, rho_, "rho", -999., kBabyEvent)
+
+//////////////
+// End Jets //
+//////////////
+
+
+
+// transverse W mass
+BABY_BRANCH  (Float_t, mt_,   "mt",   -999, kBabyLepton)
+BABY_BRANCH  (Float_t, pfmt_, "pfmt", -999, kBabyLepton)
+
+// do the 3 electron charges agree?
+BABY_BRANCH  (Bool_t, q3_, "q3", false, kBabyLepton)
+
+// Missing hit info
+BABY_BRANCH  (Int_t, els_exp_innerlayers_, "els_exp_innerlayers", 999, kBabyLepton)
+
+#undef BABY_BRANCH
+#undef BABY_VARIABLE
+#undef BABY_FLAG
+#undef BABY_TRIGGER
@@ -4,15 +4,27 @@
 // C++ includes
 #include <iostream>
 #include <fstream>
+#include <sstream>
 #include <set>
+#include <map>
 #include <exception>
+#include <stdexcept>
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <unistd.h>
+#include <sys/wait.h>
 
 // ROOT includes
 #include "TSystem.h"
 #include "TChain.h"
 #include "TDirectory.h"
 #include "TChainElement.h"
+#include "TBranch.h"
+#include "TKey.h"
+#include "TLeaf.h"
 #include "TH1F.h"
 #include "TH2F.h"
 #include "Math/VectorUtil.h"
@@ -45,6 +57,10 @@
 #include "ssSelections.h"
 #include "ttvSelections.h"
 #include "jetcorr/FactorizedJetCorrector.h"
+#include "DuplicateEventFilter.h"
+#include "GoodRunList.h"
+#include "BabyMetadata.h"
+#include "BabyEvents.h"
 #else
 // for compiling in ACLiC (.L myBabyMaker.c++ method)
 // since the source files are included
@@ -66,6 +82,10 @@
 #include "../CORE/susySelections.cc"
 #include "../CORE/jetcorr/FactorizedJetCorrector.h"
 #include "../CORE/ttvSelections.cc"
+#include "DuplicateEventFilter.cc"
+#include "GoodRunList.cc"
+#include "BabyMetadata.h"
+#include "BabyEvents.h"
 #endif // __CINT__
 #endif // __NON_ROOT_BUILD__
 
@@ -74,84 +94,138 @@ using namespace std;
 using namespace tas;
 
 #ifndef __CINT__
-bool header1 = false;
-bool header2 = false;
-
-void PrintTriggerDebugHeader(string outfileName)
-{
-    int width  = 7;
-    ofstream outfile( Form("triggerStudy/%s", outfileName.c_str() ), ios::app );
-    outfile  
-        <<  setw(width) << "itrg"
-        <<  setw(width) << "id"
-        <<  setw(width) << "match"
-        <<  setw(width) << "matchId"
-        <<  setw(width) << "dr"
-        <<  setw(width) << "lep pt"
-        <<  setw(width) << "trg pt"
-        <<  setw(width) << "lep eta"
-        <<  setw(width) << "trg eta"
-        <<  setw(width) << "lep phi"
-        <<  setw(width) << "trg phi" 
-        << "\t"         << "trigString" << endl << endl;
-    outfile.close();
-}
+//////////////////////////
+// Debug Mixed Triggers //
+//////////////////////////
+
+// Dump of the trigger objects of a few triggers into triggerStudy/<trigger>.txt.
+// Off by default (myBabyMaker::SetTriggerStudy); compiled out with __NO_TRIGGER_STUDY__.
+// One buffered stream per studied trigger stays open for the whole job.
+class TriggerStudySink
+{
+public:
 
-void PrintTriggerDebugLine
-(
-    int itrg, 
-    int id, 
-    bool match, 
-    bool matchId, 
-    double dr, 
-    const LorentzVector& lepton_p4, 
-    const LorentzVector& p4tr, 
-    const string& trigString, 
-    int nTrig, 
-    const string& outfileName
-    )
-{
-    ofstream outfile( Form("triggerStudy/%s", outfileName.c_str() ), ios::app );
-
-    int precis = 2;
-    int width  = 7;
-    outfile.setf( ios::fixed, ios::floatfield );
-    outfile << setprecision(precis) << setw(width) << setfill(' ') << itrg
-            << setprecision(precis) << setw(width) << setfill(' ') << id
-            << setprecision(precis) << setw(width) << setfill(' ') << match
-            << setprecision(precis) << setw(width) << setfill(' ') << matchId
-            << setprecision(precis) << setw(width) << setfill(' ') << dr
-            << setprecision(precis) << setw(width) << setfill(' ') << lepton_p4.pt()
-            << setprecision(precis) << setw(width) << setfill(' ') << p4tr.pt()
-            << setprecision(precis) << setw(width) << setfill(' ') << lepton_p4.eta()
-            << setprecision(precis) << setw(width) << setfill(' ') << p4tr.eta()
-            << setprecision(precis) << setw(width) << setfill(' ') << lepton_p4.phi()
-            << setprecision(precis) << setw(width) << setfill(' ') << p4tr.phi()
-            << "\t" << trigString << endl;
-    if( itrg == nTrig-1 ) outfile << endl;
-    outfile.close();
-}
+    TriggerStudySink() : enabled_(false) {}
+    ~TriggerStudySink() {Close();}
+
+    void SetEnabled(bool enabled) {enabled_ = enabled;}
+    bool Enabled() const {return enabled_;}
+
+    // stream for the trigger trigName (NULL if the trigger is not studied)
+    std::ofstream* Stream(const char* trigName)
+    {
+#ifndef __NO_TRIGGER_STUDY__
+        if (!enabled_)
+            return NULL;
+
+        static const char* triggers[] = {
+            "HLT_Ele8",
+            "HLT_Ele8_CaloIdL_TrkIdVL",
+            "HLT_Ele8_CaloIdL_CaloIsoVL",
+            "HLT_Ele17_CaloIdL_CaloIsoVL",
+            "HLT_Ele8_CaloIdL_CaloIsoVL_Jet40"
+        };
+        for (unsigned int i = 0; i < sizeof(triggers)/sizeof(triggers[0]); i++) {
+            if (
+                ( strcmp( trigName, Form( "%s_%s", triggers[i], "v1" ) ) != 0 ) && 
+                ( strcmp( trigName, Form( "%s_%s", triggers[i], "v2" ) ) != 0 )
+                ) 
+                continue;
+
+            std::ofstream*& outfile = streams_[triggers[i]];
+            if (outfile == NULL) {
+                outfile = new std::ofstream( Form("triggerStudy/%s.txt", triggers[i]), ios::app );
+                PrintHeader(*outfile);
+            }
+            return outfile;
+        }
+#endif // __NO_TRIGGER_STUDY__
+        return NULL;
+    }
 
-bool found_ele8 = false;
-bool found_ele8_CaloIdL_TrkIdVL = false;
-bool found_ele8_CaloIdL_CaloIsoVL = false;
-bool found_ele17_CaloIdL_CaloIsoVL = false;
-bool found_ele8_CaloIdL_CaloIsoVL_Jet40 = false;
+    // flush and close all the streams
+    void Close()
+    {
+        for (std::map<std::string, std::ofstream*>::iterator it = streams_.begin(); it != streams_.end(); it++) {
+            it->second->close();
+            delete it->second;
+        }
+        streams_.clear();
+    }
+
+    static void PrintLine
+    (
+        std::ofstream& outfile,
+        int itrg, 
+        int id, 
+        bool match, 
+        bool matchId, 
+        double dr, 
+        const LorentzVector& lepton_p4, 
+        const LorentzVector& p4tr, 
+        const char* trigString, 
+        int nTrig
+        )
+    {
+        int precis = 2;
+        int width  = 7;
+        outfile.setf( ios::fixed, ios::floatfield );
+        outfile << setprecision(precis) << setw(width) << setfill(' ') << itrg
+                << setprecision(precis) << setw(width) << setfill(' ') << id
+                << setprecision(precis) << setw(width) << setfill(' ') << match
+                << setprecision(precis) << setw(width) << setfill(' ') << matchId
+                << setprecision(precis) << setw(width) << setfill(' ') << dr
+                << setprecision(precis) << setw(width) << setfill(' ') << lepton_p4.pt()
+                << setprecision(precis) << setw(width) << setfill(' ') << p4tr.pt()
+                << setprecision(precis) << setw(width) << setfill(' ') << lepton_p4.eta()
+                << setprecision(precis) << setw(width) << setfill(' ') << p4tr.eta()
+                << setprecision(precis) << setw(width) << setfill(' ') << lepton_p4.phi()
+                << setprecision(precis) << setw(width) << setfill(' ') << p4tr.phi()
+                << "\t" << trigString << '\n';
+        if( itrg == nTrig-1 ) outfile << '\n';
+    }
+
+private:
+
+    static void PrintHeader(std::ofstream& outfile)
+    {
+        int width  = 7;
+        outfile  
+            <<  setw(width) << "itrg"
+            <<  setw(width) << "id"
+            <<  setw(width) << "match"
+            <<  setw(width) << "matchId"
+            <<  setw(width) << "dr"
+            <<  setw(width) << "lep pt"
+            <<  setw(width) << "trg pt"
+            <<  setw(width) << "lep eta"
+            <<  setw(width) << "trg eta"
+            <<  setw(width) << "lep phi"
+            <<  setw(width) << "trg phi" 
+            << "\t"         << "trigString" << '\n' << '\n';
+    }
+
+    bool enabled_;
+    std::map<std::string, std::ofstream*> streams_;
+};
+
+TriggerStudySink trigger_study;
 
 // function for dR matching offline letpon to trigger object 
-pair<int, float> TriggerMatch( LorentzVector lepton_p4, const char* trigString, double dR_cut = 0.4, int pid = 11 )
+// (the trigger is given by its index in hlt_trigNames; study is the trigger study stream or NULL)
+pair<int, float> TriggerMatch( LorentzVector lepton_p4, unsigned int trigIndex, std::ofstream* study = NULL, double dR_cut = 0.4, int pid = 11 )
 {
     float dR_min = numeric_limits<float>::max();
     dR_min = 99.0;
-    int nTrig = nHLTObjects(trigString);
+    int nTrig = cms2.hlt_bits().TestBitNumber(trigIndex) ? cms2.hlt_trigObjs_p4().at(trigIndex).size() : 0;
     if (nTrig > 0) {
         bool match   = false;
         bool matchId = false;
 
         for (int itrg=0; itrg<nTrig; itrg++) 
         {
-            LorentzVector p4tr = p4HLTObject( trigString, itrg );
-            int id             = idHLTObject( trigString, itrg );
+            const LorentzVector& p4tr = cms2.hlt_trigObjs_p4().at(trigIndex).at(itrg);
+            int id                    = cms2.hlt_trigObjs_id().at(trigIndex).at(itrg);
             double dr = ROOT::Math::VectorUtil::DeltaR( lepton_p4, p4tr);
             if ( dr < dR_cut ){
                 match = true;
@@ -160,78 +234,9 @@ pair<int, float> TriggerMatch( LorentzVector lepton_p4, const char* trigString,
             if (dr < dR_min) dR_min = dr;
 
 
-            //////////////////////////
-            // Debug Mixed Triggers //
-            //////////////////////////
-            vector<string> triggers;
-            triggers.push_back("HLT_Ele8");
-            triggers.push_back("HLT_Ele8_CaloIdL_TrkIdVL");
-            triggers.push_back("HLT_Ele8_CaloIdL_CaloIsoVL");
-            triggers.push_back("HLT_Ele17_CaloIdL_CaloIsoVL");
-            triggers.push_back("HLT_Ele8_CaloIdL_CaloIsoVL_Jet40");
-            for (unsigned int i=0; i < triggers.size(); i++) {
-                if (
-                    ( strcmp( trigString, Form( "%s_%s", triggers.at(i).c_str(), "v1" ) ) == 0 ) || 
-                    ( strcmp( trigString, Form( "%s_%s", triggers.at(i).c_str(), "v2" ) ) == 0 )
-                    ) {
-
-                    //
-                    if(
-                        ( strcmp( trigString, "HLT_Ele8_v1") == 0 ) || 
-                        ( strcmp( trigString, "HLT_Ele8_v2") == 0 )
-                        ){
-                        if(found_ele8 == false){
-                            found_ele8 = true;
-                            PrintTriggerDebugHeader( Form("%s.txt",triggers.at(i).c_str()) );
-                        }
-                    }
-
-                    //
-                    if(
-                        ( strcmp( trigString, "HLT_Ele8_CaloIdL_TrkIdVL_v1") == 0 ) || 
-                        ( strcmp( trigString, "HLT_Ele8_CaloIdL_TrkIdVL_v2") == 0 )
-                        ){
-                        if(found_ele8_CaloIdL_TrkIdVL == false){
-                            found_ele8_CaloIdL_TrkIdVL = true;
-                            PrintTriggerDebugHeader( Form("%s.txt",triggers.at(i).c_str()) );
-                        }
-                    }
-
-                    //
-                    if(
-                        ( strcmp( trigString, "HLT_Ele8_CaloIdL_CaloIsoVL_v1") == 0 ) || 
-                        ( strcmp( trigString, "HLT_Ele8_CaloIdL_CaloIsoVL_v2") == 0 )
-                        ){
-                        if(found_ele8_CaloIdL_CaloIsoVL == false){
-                            found_ele8_CaloIdL_CaloIsoVL = true;
-                            PrintTriggerDebugHeader( Form("%s.txt",triggers.at(i).c_str()) );
-                        }
-                    }
-
-                    //
-                    if(
-                        ( strcmp( trigString, "HLT_Ele17_CaloIdL_CaloIsoVL_v1") == 0 ) ||
-                        ( strcmp( trigString, "HLT_Ele17_CaloIdL_CaloIsoVL_v2") == 0 )
-                        ){
-                        if(found_ele17_CaloIdL_CaloIsoVL == false){
-                            found_ele17_CaloIdL_CaloIsoVL = true;
-                            PrintTriggerDebugHeader( Form("%s.txt",triggers.at(i).c_str()) );
-                        }
-                    }
-
-                    //
-                    if(
-                        ( strcmp( trigString, "HLT_Ele8_CaloIdL_CaloIsoVL_Jet40_v1") == 0 ) || 
-                        ( strcmp( trigString, "HLT_Ele8_CaloIdL_CaloIsoVL_Jet40_v2") == 0 )
-                        ){
-                        if(found_ele8_CaloIdL_CaloIsoVL_Jet40 == false){
-                            found_ele8_CaloIdL_CaloIsoVL_Jet40 = true;
-                            PrintTriggerDebugHeader( Form("%s.txt",triggers.at(i).c_str()) );
-                        }
-                    }
-
-                    PrintTriggerDebugLine( itrg, id, match, matchId, dr, lepton_p4, p4tr, trigString, nTrig, Form("%s.txt", triggers.at(i).c_str() ) );
-                }
+            // Debug Mixed Triggers
+            if (study) {
+                TriggerStudySink::PrintLine( *study, itrg, id, match, matchId, dr, lepton_p4, p4tr, cms2.hlt_trigNames().at(trigIndex).Data(), nTrig );
             }
 
         } // end loop on triggers
@@ -271,37 +276,94 @@ struct triggerMatchStruct
     int l1ps_;  // not used yet
 };
 
-// wrapper around TriggerMatch that takes a TRegExp for matching a class of triggers
-triggerMatchStruct MatchTriggerClass(LorentzVector lepton_p4, TPMERegexp& regexp, int pid = 11, double dR_cut = 0.4)
+// Triggers of the current HLT menu matching each trigger class regexp.
+// The regexps are only run once per menu (new file or new run);
+// after that MatchTriggerClass only looks up the trigger indices.
+class TriggerClassIndex
 {
-    std::pair<int, float> triggerMatchValues = make_pair (0, 99.);
-    triggerMatchStruct triggerMatchInfo = triggerMatchStruct(triggerMatchValues.first, triggerMatchValues.second, -1, -1);
-    
-    unsigned int loopCounts = 0;
-    for (unsigned int tidx = 0; tidx < cms2.hlt_trigNames().size(); tidx++) {
-        if (regexp.Match(cms2.hlt_trigNames().at(tidx)) == 0)
-            continue;
+public:
 
-        ++loopCounts;
+    struct Entry
+    {
+        std::vector<unsigned int> trigIndex;  // index in hlt_trigNames
+        std::vector<int> version;             // version number from the regexp (-1 if none)
+        std::vector<std::ofstream*> study;    // trigger study stream (NULL if not studied)
+    };
 
-        // get lepton-trigger matching information
-        triggerMatchValues = TriggerMatch(lepton_p4, cms2.hlt_trigNames().at(tidx).Data(), dR_cut, pid);
+    TriggerClassIndex() : run_(-1) {}
+
+    // forget the current menu (call when a new file is opened)
+    void Clear()
+    {
+        entries_.clear();
+        run_ = -1;
+    }
+
+    const Entry& Find(TPMERegexp& regexp)
+    {
+        // the menu can only change between runs
+        if (cms2.evt_run() != run_)
+        {
+            entries_.clear();
+            run_ = cms2.evt_run();
+        }
+
+        std::map<const TPMERegexp*, Entry>::const_iterator it = entries_.find(&regexp);
+        if (it != entries_.end())
+            return it->second;
 
-        int version = -1;
-        TString tversion = regexp[1];
-        if (tversion.IsDigit())
-            version = tversion.Atoi();
-        int hltprescale = HLT_prescale(cms2.hlt_trigNames().at(tidx).Data());
+        Entry& entry = entries_[&regexp];
+        for (unsigned int tidx = 0; tidx < cms2.hlt_trigNames().size(); tidx++) {
+            if (regexp.Match(cms2.hlt_trigNames().at(tidx)) == 0)
+                continue;
 
-        triggerMatchInfo = triggerMatchStruct(triggerMatchValues.first, triggerMatchValues.second, version, hltprescale);
+            int version = -1;
+            TString tversion = regexp[1];
+            if (tversion.IsDigit())
+                version = tversion.Atoi();
+
+            entry.trigIndex.push_back(tidx);
+            entry.version.push_back(version);
+            entry.study.push_back(trigger_study.Stream(cms2.hlt_trigNames().at(tidx).Data()));
+        }
+        return entry;
     }
 
+private:
+
+    int run_;
+    std::map<const TPMERegexp*, Entry> entries_;
+};
+
+TriggerClassIndex trigger_class_index;
+
+// wrapper around TriggerMatch that takes a TRegExp for matching a class of triggers
+triggerMatchStruct MatchTriggerClass(LorentzVector lepton_p4, TPMERegexp& regexp, int pid = 11, double dR_cut = 0.4)
+{
+    std::pair<int, float> triggerMatchValues = make_pair (0, 99.);
+    triggerMatchStruct triggerMatchInfo = triggerMatchStruct(triggerMatchValues.first, triggerMatchValues.second, -1, -1);
+    
+    const TriggerClassIndex::Entry& triggers = trigger_class_index.Find(regexp);
+    unsigned int loopCounts = triggers.trigIndex.size();
+
     //assert (loopCounts < 2);
     // check that we counted at least two matches
     if (loopCounts >= 2)
     {
         throw std::logic_error(Form("[FR baby maker]: MatchTriggerClass - looper cout is greater than two. loopCounts = %u", loopCounts));
     }
+
+    if (loopCounts == 1)
+    {
+        const unsigned int tidx = triggers.trigIndex.front();
+
+        // get lepton-trigger matching information
+        triggerMatchValues = TriggerMatch(lepton_p4, tidx, triggers.study.front(), dR_cut, pid);
+
+        int hltprescale = cms2.hlt_prescales().at(tidx);
+
+        triggerMatchInfo = triggerMatchStruct(triggerMatchValues.first, triggerMatchValues.second, triggers.version.front(), hltprescale);
+    }
     return triggerMatchInfo;
 }
 
@@ -337,12 +399,11 @@ bool DorkyEventIdentifier::operator == (const DorkyEventIdentifier &other) const
     return true;
 }
 
-std::set<DorkyEventIdentifier> already_seen;
+// flat hash tables per run and lumi (see DuplicateEventFilter.h)
+DuplicateEventFilter already_seen;
 bool is_duplicate (const DorkyEventIdentifier &id)
 {
-    std::pair<std::set<DorkyEventIdentifier>::const_iterator, bool> ret =
-        already_seen.insert(id);
-    return !ret.second;
+    return already_seen.IsDuplicate(id.run, id.lumi, id.event);
 }
 
 // transverse mass
@@ -351,17 +412,594 @@ float Mt( LorentzVector p4, float met, float met_phi )
     return sqrt( 2*met*( p4.pt() - ( p4.Px()*cos(met_phi) + p4.Py()*sin(met_phi) ) ) );
 }
 
+// number of objects in the event passing a selection; the lepton under
+// consideration can be left out of the count when the baby is filled
+struct ObjectCount
+{
+    void Reset(unsigned int nobjects)
+    {
+        pass.assign(nobjects, false);
+        n          = 0;
+        leading    = -1;
+        subleading = -1;
+    }
+
+    void Add(unsigned int idx, float pt)
+    {
+        pass.at(idx) = true;
+        ++n;
+
+        // keep the two highest pt objects (first one wins on ties)
+        if (leading < 0 || pt > leading_pt)
+        {
+            subleading    = leading;
+            subleading_pt = leading_pt;
+            leading       = idx;
+            leading_pt    = pt;
+        }
+        else if (subleading < 0 || pt > subleading_pt)
+        {
+            subleading    = idx;
+            subleading_pt = pt;
+        }
+    }
+
+    // count without the object skip (-1 = keep everything)
+    int Count(int skip = -1) const
+    {
+        return n - ((skip >= 0 && pass.at(skip)) ? 1 : 0);
+    }
+
+    // index of the highest pt object other than skip (-1 if there is none)
+    int Leading(int skip = -1) const
+    {
+        return (leading == skip) ? subleading : leading;
+    }
+
+    std::vector<bool> pass;
+    int   n;
+    int   leading;
+    int   subleading;
+    float leading_pt;
+    float subleading_pt;
+};
+
+// event level quantities: computed once per event and shared by the electron and muon blocks
+// (the lepton counts need the ID and PF isolation of every lepton, so FillLeptons
+// is left until a lepton of the event passes the denominator filter)
+struct EventContext
+{
+    EventContext() : hasLeptons(false) {}
+
+    void Fill(bool isData)
+    {
+        // Basic Event Information
+        run          = evt_run();
+        ls           = evt_lumiBlock();
+        evt          = evt_event();
+        weight       = isData ? 1.0 : evt_scale1fb();
+        dataset      = evt_dataset().front();
+        is_real_data = evt_isRealData();
+        pfmet        = evt_pfmet();
+        pfmetphi     = evt_pfmetPhi();
+        rho          = cms2.evt_rho();
+
+        // Pileup - PUSummaryInfoMaker
+        pu_nPUvertices = -1;
+        pu_nPUtrueint  = -1.0;
+        if (!isData)
+        {
+            for (unsigned int vidx = 0; vidx < cms2.puInfo_nPUvertices().size(); vidx++)
+            {
+                if (cms2.puInfo_bunchCrossing().at(vidx) != 0)
+                    continue;
+                pu_nPUvertices = cms2.puInfo_nPUvertices().at(vidx);
+                pu_nPUtrueint  = cms2.puInfo_trueNumInteractions().at(vidx);
+            }
+        }
+
+        // Pileup - VertexMaker (starts from -1 like the baby default)
+        evt_nvtxs = -1;
+        for (unsigned int vidx = 0; vidx < cms2.vtxs_position().size(); vidx++)
+        {
+            if (isGoodVertex(vidx))
+                ++evt_nvtxs;
+        }
+    }
+
+    void FillLeptons()
+    {
+        hasLeptons = true;
+
+        // electrons: FOs (use SS FO definition), gsfs and "veto" electrons
+        foels.Reset(cms2.els_p4().size());
+        gsfs.Reset(cms2.els_p4().size());
+        vetoels.Reset(cms2.els_p4().size());
+        for (unsigned int iel = 0; iel < cms2.els_p4().size(); iel++)
+        {
+            const float pt = cms2.els_p4().at(iel).pt();
+            if (pt >= 10.)
+            {
+                if (pass_electronSelection(iel, electronSelectionFOV7_v3, false, false))
+                    gsfs.Add(iel, pt);
+
+                if (samesign::isDenominatorLepton(11, iel))
+                    foels.Add(iel, pt);
+            }
+
+            if (pt < 5.0f)
+                continue;
+
+            if (fabs(cms2.els_p4().at(iel).eta()) > 2.4f)
+                continue;
+
+            const float iso = electronIsoValuePF2012_FastJetEffArea_v3(iel, /*conesize=*/0.3, /*vtx=*/-999, /*52X iso=*/false);
+            if (iso > 1.0)
+                continue;
+
+            vetoels.Add(iel, pt);
+        }
+
+        // muons: FOs (use SS FO definition), non-isolated FOs and "veto" muons
+        fomus.Reset(cms2.mus_p4().size());
+        mus.Reset(cms2.mus_p4().size());
+        vetomus.Reset(cms2.mus_p4().size());
+        for (unsigned int imu = 0; imu < cms2.mus_p4().size(); imu++)
+        {
+            const float pt = cms2.mus_p4().at(imu).pt();
+            if (pt >= 10.)
+            {
+                if (muonIdNotIsolated(imu, muonSelectionFO_ssV5))
+                    mus.Add(imu, pt);
+
+                if (samesign::isDenominatorLepton(13, imu))
+                    fomus.Add(imu, pt);
+            }
+
+            if (pt < 5.0f)
+                continue;
+
+            if (fabs(cms2.mus_p4().at(imu).eta()) > 2.4f)
+                continue;
+
+            const bool is_global      = ((cms2.mus_type().at(imu) & (1<<1)) != 0);
+            const bool is_tracker     = ((cms2.mus_type().at(imu) & (1<<2)) != 0);
+            const bool is_pfmu        = ((cms2.mus_type().at(imu) & (1<<5)) != 0);
+            const bool passes_mu_type = ((is_global or is_tracker) and is_pfmu);
+            if (not passes_mu_type)
+                continue;
+
+            const float iso = muonIsoValuePF2012_deltaBeta(imu); 
+            if (iso > 1.0)
+                continue;
+
+            vetomus.Add(imu, pt);
+        }
+    }
+
+    Int_t   run;
+    Int_t   ls;
+    UInt_t  evt;
+    Float_t weight;
+    TString dataset;
+    Bool_t  is_real_data;
+    Int_t   pu_nPUvertices;
+    Float_t pu_nPUtrueint;
+    Int_t   evt_nvtxs;
+    Float_t pfmet;
+    Float_t pfmetphi;
+    Float_t rho;
+
+    bool        hasLeptons;
+    ObjectCount foels;
+    ObjectCount gsfs;
+    ObjectCount vetoels;
+    ObjectCount fomus;
+    ObjectCount mus;
+    ObjectCount vetomus;
+};
+
+// PF jets of the event: jet ID, b-tag, EM fraction and the kinematics at each
+// correction level, one array per quantity.  Filled once per event and used
+// for all the jet variables of every lepton (see myBabyMaker::FillJetVariables).
+struct PFJetCache
+{
+    enum Level {RAW, L2L3, L1F, L1FRES, NLEVELS};
+
+    void Fill(FactorizedJetCorrector* jet_pf_L2L3corrector)
+    {
+        const unsigned int njets = cms2.pfjets_p4().size();
+        id.assign(njets, false);
+        csv.assign(njets, -999.);
+        emf.assign(njets, -999.);
+        for (unsigned int level = 0; level < NLEVELS; level++)
+        {
+            pt [level].assign(njets, -999.);
+            eta[level].assign(njets, -999.);
+            phi[level].assign(njets, -999.);
+        }
+
+        // b-tagged jets (pt > 15, CSV medium) used for the dR to the lepton
+        btag_level = cms2.evt_isRealData() ? L1FRES : L1F;
+        bjets.clear();
+
+        // any b-tagged jet in the event at the given correction level
+        btag_L2L3  = false;
+        btag_L1F   = false;
+        btag_L1Fres = false;
+
+        for (unsigned int iJet = 0; iJet < njets; iJet++)
+        {
+            LorentzVector jp4 = cms2.pfjets_p4().at(iJet);
+            Set(RAW, iJet, jp4);
+            csv.at(iJet) = cms2.pfjets_combinedSecondaryVertexBJetTag().at(iJet);
+            emf.at(iJet) = (cms2.pfjets_chargedEmE().at(iJet) + cms2.pfjets_neutralEmE().at(iJet)) / jp4.E();
+
+            // only the raw jets are used without the jet ID
+            id.at(iJet) = passesPFJetID(iJet);
+            if (!id.at(iJet)) continue;
+
+            Set(L2L3  , iJet, jp4 * jetCorrection(jp4, jet_pf_L2L3corrector));
+            Set(L1F   , iJet, jp4 * cms2.pfjets_corL1FastL2L3().at(iJet));
+            Set(L1FRES, iJet, jp4 * cms2.pfjets_corL1FastL2L3residual().at(iJet));
+
+            if (pt[L2L3  ].at(iJet) > 15 && csv.at(iJet) > 0.679) btag_L2L3   = true;
+            if (pt[L1F   ].at(iJet) > 15 && csv.at(iJet) > 0.679) btag_L1F    = true;
+            if (pt[L1FRES].at(iJet) > 15 && csv.at(iJet) > 0.679) btag_L1Fres = true;
+
+            if (pt[btag_level].at(iJet) < 15) continue;
+            if (csv.at(iJet) < 0.679) continue;
+            bjets.push_back(iJet);
+        }
+    }
+
+    unsigned int size() const {return id.size();}
+
+    // same arithmetic as ROOT::Math::VectorUtil::DeltaPhi(lep, jet) for float vectors
+    float DeltaPhi(int level, unsigned int iJet, float lep_phi) const
+    {
+        float dphi = phi[level][iJet] - lep_phi;
+        if (dphi > M_PI)
+            dphi -= 2.0*M_PI;
+        else if (dphi <= -M_PI)
+            dphi += 2.0*M_PI;
+        return dphi;
+    }
+
+    // same arithmetic as ROOT::Math::VectorUtil::DeltaR(lep, jet) for float vectors
+    float DeltaR(int level, unsigned int iJet, float lep_eta, float lep_phi) const
+    {
+        const float dphi = DeltaPhi(level, iJet, lep_phi);
+        const float deta = eta[level][iJet] - lep_eta;
+        return std::sqrt(dphi*dphi + deta*deta);
+    }
+
+    std::vector<bool>  id;
+    std::vector<float> csv;
+    std::vector<float> emf;
+    std::vector<float> pt [NLEVELS];
+    std::vector<float> eta[NLEVELS];
+    std::vector<float> phi[NLEVELS];
+
+    std::vector<unsigned int> bjets;
+    int  btag_level;
+    bool btag_L2L3;
+    bool btag_L1F;
+    bool btag_L1Fres;
+
+private:
+
+    void Set(int level, unsigned int iJet, const LorentzVector& p4)
+    {
+        pt [level].at(iJet) = p4.pt();
+        eta[level].at(iJet) = p4.eta();
+        phi[level].at(iJet) = p4.phi();
+    }
+};
+
+// compiled good run list (see GoodRunList.h)
+// if none is set, the event loop uses the Tools/goodrun lookup
+GoodRunList good_run_list;
+
+// index of name in names (added at the end if it is new)
+Int_t NameIndex(std::vector<std::string>& names, const char* name)
+{
+    // the rows mostly come from the last dataset and file added
+    for (int i = names.size() - 1; i >= 0; i--)
+    {
+        if (names[i] == name)
+            return i;
+    }
+    names.push_back(name);
+    return names.size() - 1;
+}
+
+// book a branch of the baby (see myBabyBranches.h)
+template <class T> void BookBabyBranch(TTree* tree, const char* name, T* address, Int_t basketSize)
+{
+    tree->Branch(name, address, basketSize);
+}
+
+void BookBabyBranch(TTree* tree, const char* name, TString* address, Int_t basketSize)
+{
+    tree->Branch(name, "TString", address, basketSize);
+}
+
+void BookBabyBranch(TTree* tree, const char* name, LorentzVector* address, Int_t basketSize)
+{
+    tree->Branch(name, "LorentzVector", address, basketSize);
+}
+
+// branches filled by FillEventInformation (and filename_idx): the same for
+// all the rows of an event, so they go to the events tree of SplitEventTree
+const char* const kEventBranches[] = {"run", "ls", "evt", "weight", "dataset_idx", "filename_idx", "is_real_data",
+                                      "pu_nPUvertices", "pu_nPUtrueint", "evt_nvtxs", "pfmet", "pfmetphi", "rho"};
+
+// x rounded to the nearest float with mantissaBits bits of mantissa
+inline Float_t TruncateMantissa(Float_t x, int mantissaBits)
+{
+    if (mantissaBits >= 23)
+        return x;
+    UInt_t bits = 0;
+    memcpy(&bits, &x, sizeof(bits));
+    if ((bits & 0x7f800000u) == 0x7f800000u)
+        return x;  // inf or nan
+    const unsigned int dropped = 23 - mantissaBits;
+    bits += (1u << (dropped - 1));
+    bits &= ~((1u << dropped) - 1);
+    memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+// reduced precision value of x and its error
+inline Float_t QuantizeFloat(QuantizedBranch& branch, Float_t x)
+{
+    Float_t q = TruncateMantissa(x, branch.mantissaBits);
+    if (branch.quantum > 0)
+        q = branch.quantum * floor(q / branch.quantum + 0.5);
+    const Double_t error = fabs(static_cast<Double_t>(q) - x);
+    branch.maxAbsError = std::max(branch.maxAbsError, error);
+    if (x != 0)
+        branch.maxRelError = std::max(branch.maxRelError, error / fabs(x));
+    return q;
+}
+
+// only the float and 4-vector branches have a reduced precision
+template <class T> void AddQuantizedBranch(std::vector<QuantizedBranch>& branches, const char* name, T* member, int mantissaBits, Float_t quantum)
+{
+}
+
+void AddQuantizedBranch(std::vector<QuantizedBranch>& branches, const char* name, Float_t* member, int mantissaBits, Float_t quantum)
+{
+    if (mantissaBits >= 23 && quantum <= 0)
+        return;
+    QuantizedBranch branch;
+    branch.name         = name;
+    branch.value        = member;
+    branch.p4           = NULL;
+    branch.sentinel     = *member;
+    branch.mantissaBits = mantissaBits;
+    branch.quantum      = quantum;
+    branch.maxAbsError  = 0;
+    branch.maxRelError  = 0;
+    branches.push_back(branch);
+}
+
+void AddQuantizedBranch(std::vector<QuantizedBranch>& branches, const char* name, LorentzVector* member, int mantissaBits, Float_t quantum)
+{
+    if (mantissaBits >= 23 && quantum <= 0)
+        return;
+    QuantizedBranch branch;
+    branch.name         = name;
+    branch.value        = NULL;
+    branch.p4           = member;
+    branch.sentinel     = 0;
+    branch.mantissaBits = mantissaBits;
+    branch.quantum      = quantum;
+    branch.maxAbsError  = 0;
+    branch.maxRelError  = 0;
+    branches.push_back(branch);
+}
+
+// the baby variables by branch name for the fake rate cuts (see BabyCut.h)
+template <class T> void AddCutVariable(BabyCutVariables& variables, const char* name, T* member)
+{
+}
+
+void AddCutVariable(BabyCutVariables& variables, const char* name, Float_t* member)
+{
+    BabyCutVariable variable = {member, 'F'};
+    variables[name] = variable;
+}
+
+void AddCutVariable(BabyCutVariables& variables, const char* name, Int_t* member)
+{
+    BabyCutVariable variable = {member, 'I'};
+    variables[name] = variable;
+}
+
+void AddCutVariable(BabyCutVariables& variables, const char* name, UInt_t* member)
+{
+    BabyCutVariable variable = {member, 'i'};
+    variables[name] = variable;
+}
+
+void AddCutVariable(BabyCutVariables& variables, const char* name, Bool_t* member)
+{
+    BabyCutVariable variable = {member, 'O'};
+    variables[name] = variable;
+}
+
+// largest branches first in the compression report
+struct BranchSize
+{
+    std::string name;
+    Long64_t totBytes;
+    Long64_t zipBytes;
+    bool operator < (const BranchSize& other) const {return zipBytes > other.zipBytes;}
+};
+
 #endif // __CINT__
 
+// select the baby branches by name:
+//   all         - everything
+//   ss2012      - what the 2012 same-sign analysis needs (no 2011 selections and triggers)
+//   no-triggers - everything but the trigger matching
+void myBabyMaker::SetBranchProfile(const std::string& profile)
+{
+    if (profile == "all")
+        branchGroups_ = kBabyAll;
+    else if (profile == "ss2012")
+        branchGroups_ = kBabyEvent | kBabyLepton | kBabyIsolation | kBabyMCTruth | kBabySelections2012 | kBabyTriggers2012 | kBabyJets;
+    else if (profile == "no-triggers")
+        branchGroups_ = kBabyAll & ~(kBabyTriggers2012 | kBabyTriggers2011);
+    else
+        throw std::logic_error(Form("[FR baby maker]: unknown branch profile %s (all, ss2012 or no-triggers)", profile.c_str()));
+}
+
+// compression of the baby files: algorithm zlib, lzma, lz4 or zstd and level
+// 0 (no compression) to 9.  lz4 needs ROOT 6.14 or later and zstd ROOT 6.20.
+// The plotting macros read the babies many times, so lz4 or zstd usually pay
+// off on the read side; measure with SetCompressionReport.
+void myBabyMaker::SetCompression(const std::string& algorithm, int level)
+{
+    int code = 0;
+    if (algorithm == "zlib")
+        code = 1;
+    else if (algorithm == "lzma")
+        code = 2;
+    else if (algorithm == "lz4")
+        code = 4;
+    else if (algorithm == "zstd")
+        code = 5;
+    else
+        throw std::logic_error(Form("[FR baby maker]: unknown compression algorithm %s (zlib, lzma, lz4 or zstd)", algorithm.c_str()));
+
+    if (level < 0 || level > 9)
+    {
+        throw std::logic_error(Form("[FR baby maker]: compression level %d is not between 0 and 9", level));
+    }
+    compressionSettings_ = 100 * code + level;
+}
+
+// basket size in bytes of the branches of the groups (e.g. kBabyTriggers2012 | kBabyTriggers2011)
+void myBabyMaker::SetBasketSize(unsigned int groups, Int_t bytes)
+{
+    if (bytes <= 0)
+    {
+        throw std::logic_error(Form("[FR baby maker]: basket size %d is not positive", bytes));
+    }
+    for (unsigned int igroup = 0; igroup < kNumBranchGroups; igroup++)
+    {
+        if (groups & (1u << igroup))
+            basketSizes_.at(igroup) = bytes;
+    }
+}
+
+// Store the floats of the groups with mantissaBits bits of mantissa (of 23)
+// instead of full precision.  The values are rounded in FillBabyNtuple, so the
+// branches stay floats; the zeroed low bits are what the compression saves.
+// 12 bits is a relative precision of 1.2e-4.
+void myBabyMaker::SetFloatPrecision(unsigned int groups, int mantissaBits)
+{
+    if (mantissaBits < 1 || mantissaBits > 23)
+    {
+        throw std::logic_error(Form("[FR baby maker]: %d mantissa bits is not between 1 and 23", mantissaBits));
+    }
+    for (unsigned int igroup = 0; igroup < kNumBranchGroups; igroup++)
+    {
+        if (groups & (1u << igroup))
+            floatMantissaBits_.at(igroup) = mantissaBits;
+    }
+}
+
+// Store the floats of the groups as multiples of quantum (fixed point), e.g.
+// 0.001 for isolations.  The defaults of the members (-999., 99., ...) are kept exact.
+void myBabyMaker::SetFloatQuantum(unsigned int groups, Float_t quantum)
+{
+    if (quantum < 0)
+    {
+        throw std::logic_error(Form("[FR baby maker]: quantum %g is negative", quantum));
+    }
+    for (unsigned int igroup = 0; igroup < kNumBranchGroups; igroup++)
+    {
+        if (groups & (1u << igroup))
+            floatQuanta_.at(igroup) = quantum;
+    }
+}
+
+// the branch groups of myBabyBranches.h have a single bit
+unsigned int myBabyMaker::GroupIndex(unsigned int group)
+{
+    for (unsigned int igroup = 0; igroup < kNumBranchGroups; igroup++)
+    {
+        if (group & (1u << igroup))
+            return igroup;
+    }
+    throw std::logic_error(Form("[FR baby maker]: no branch group in %u", group));
+}
+
+// Fill a fake rate in the event loop instead of from the baby afterwards:
+// the rows passing cuts and the numerator (denominator) selection go into
+// <label>_num (<label>_den), pt vs |eta| with the given bins, and <label>_num1
+// (<label>_den1), pt.  CloseBabyNtuple writes them with <label>_fr, num/den
+// with binomial errors as eff2 makes it.  The selections are strings over the
+// branches of the selected groups (see BabyCut.h; the variables of the other
+// groups are not computed, so a cut on them is an unknown variable), e.g.
+//     baby->AddFakeRate("mu", "num_mu_ssV5", "fo_mu_ssV5", "abs(id)==13 && pt>10 && pt<35 && pfmet<20 && mt<25");
+// With SetWriteBaby(false) only the histograms are written.
+void myBabyMaker::AddFakeRate(const char* label, const char* numerator, const char* denominator, const char* cuts)
+{
+    // the bins of plotFR.C
+    const double etaBins[] = {0.0, 1.0, 1.479, 2.0, 2.5};
+    const double ptBins[]  = {10., 15., 20., 25., 30., 35.};
+    AddFakeRate(label, numerator, denominator, cuts, std::vector<double>(etaBins, etaBins + 5), std::vector<double>(ptBins, ptBins + 6));
+}
+
+void myBabyMaker::AddFakeRate(const char* label, const char* numerator, const char* denominator, const char* cuts, const std::vector<double>& etaBins, const std::vector<double>& ptBins)
+{
+    if (etaBins.size() < 2 || ptBins.size() < 2)
+    {
+        throw std::logic_error(Form("[FR baby maker]: fake rate %s needs at least one eta and one pt bin", label));
+    }
+    for (unsigned int ifr = 0; ifr < fakeRates_.size(); ifr++)
+    {
+        if (fakeRates_[ifr].label == label)
+            throw std::logic_error(Form("[FR baby maker]: fake rate %s is already defined", label));
+    }
+
+    FakeRateDefinition fakeRate;
+    fakeRate.label       = label;
+    fakeRate.numerator   = numerator;
+    fakeRate.denominator = denominator;
+    fakeRate.cuts        = cuts;
+    fakeRate.etaBins     = etaBins;
+    fakeRate.ptBins      = ptBins;
+    fakeRate.num         = NULL;
+    fakeRate.den         = NULL;
+    fakeRate.num1        = NULL;
+    fakeRate.den1        = NULL;
+    fakeRates_.push_back(fakeRate);
+}
+
 // set good run list
 void myBabyMaker::SetGoodRunList(const char* fileName, bool goodRunIsJson)
 {
     if (!std::string(fileName).empty())
     {
-        if (goodRunIsJson)
-            set_goodrun_file_json(fileName);
-        else
-            set_goodrun_file(fileName);
+        try
+        {
+            good_run_list.Load(fileName, goodRunIsJson);
+        }
+        catch (std::exception& e)
+        {
+            cout << e.what() << endl;
+            cout << "[FR baby maker]: using Tools/goodrun for " << fileName << endl;
+            if (goodRunIsJson)
+                set_goodrun_file_json(fileName);
+            else
+                set_goodrun_file(fileName);
+        }
 
         goodrun_is_json = goodRunIsJson;
     }
@@ -487,1193 +1125,924 @@ Float_t EffectiveArea_nh(float eta, float cone_size, bool use_tight)
             else if (etaAbs < 2.4) eff_area = 0.216;
         }
     }
-
-    // done
-    return eff_area;
+
+    // done
+    return eff_area;
+}
+
+// muons only
+Float_t EffectiveArea_em(float eta, float cone_size, bool use_tight)
+{
+    float etaAbs = fabs(eta);
+    float eff_area = 0.0;
+
+    if (abs(cone_size - 0.3) < 0.01)
+    {
+        if (use_tight)
+        {
+            if (etaAbs < 1.0)      eff_area = 0.118;
+            else if (etaAbs < 1.5) eff_area = 0.053;
+            else if (etaAbs < 2.0) eff_area = 0.015;
+            else if (etaAbs < 2.2) eff_area = 0.112;
+            else if (etaAbs < 2.3) eff_area = 0.302;
+            else if (etaAbs < 2.4) eff_area = 0.251;
+        }
+        else
+        {
+            if (etaAbs < 1.0)      eff_area = 0.274;
+            else if (etaAbs < 1.5) eff_area = 0.161;
+            else if (etaAbs < 2.0) eff_area = 0.079;
+            else if (etaAbs < 2.2) eff_area = 0.168;
+            else if (etaAbs < 2.3) eff_area = 0.359;
+            else if (etaAbs < 2.4) eff_area = 0.294;
+        }
+    }
+    else if (abs(cone_size - 0.4) < 0.01)
+    {
+        if (use_tight)
+        {
+            if (etaAbs < 1.0)      eff_area = 0.200;
+            else if (etaAbs < 1.5) eff_area = 0.109;
+            else if (etaAbs < 2.0) eff_area = 0.087;
+            else if (etaAbs < 2.2) eff_area = 0.184;
+            else if (etaAbs < 2.3) eff_area = 0.425;
+            else if (etaAbs < 2.4) eff_area = 0.350;
+        }
+        else
+        {
+            if (etaAbs < 1.0)      eff_area = 0.504;
+            else if (etaAbs < 1.5) eff_area = 0.306;
+            else if (etaAbs < 2.0) eff_area = 0.198;
+            else if (etaAbs < 2.2) eff_area = 0.287;
+            else if (etaAbs < 2.3) eff_area = 0.525;
+            else if (etaAbs < 2.4) eff_area = 0.488;
+        }
+    }
+
+    // done
+    return eff_area;
+}
+
+
+
+//------------------------------------------
+// Initialize baby ntuple variables
+//------------------------------------------
+void myBabyMaker::InitBabyNtuple() 
+{
+#define BABY_BRANCH(type, member, branch, value, group) member = value;
+#define BABY_VARIABLE(type, member, value, group) member = value;
+#define BABY_FLAG(member, branch, group) member = false;
+#include "myBabyBranches.h"
+}
+
+// Book the baby ntuple
+void myBabyMaker::MakeBabyNtuple(const char *babyFilename, const char *option)
+{
+    babyFile_ = TFile::Open(Form("%s", babyFilename), option);
+    if (!babyFile_ || babyFile_->IsZombie())
+        throw std::runtime_error(Form("[FR baby maker]: MakeBabyNtuple - could not open %s", babyFilename));
+    babyFile_->cd();
+    if (compressionSettings_ >= 0)
+    {
+        // the branches take the setting of the file when they are booked,
+        // and the parts of SetMaxOutputSize inherit it
+        babyFile_->SetCompressionSettings(compressionSettings_);
+    }
+    babyTree_ = new TTree("tree", "A Baby Ntuple");
+    if (autoFlush_ != 0)
+    {
+        babyTree_->SetAutoFlush(autoFlush_);
+    }
+
+    // dataset and file names of the rows (see BabyMetadata.h)
+    datasetNames_.clear();
+    fileNames_.clear();
+
+    // packed selection flags (see BookBabyFlag)
+    selectionBits2012_.clear();
+    selectionBits2011_.clear();
+    packedFlags_.clear();
+    packedWords_.clear();
+    packedMasks_.clear();
+
+    // compact trigger block (see RegisterTrigger)
+    triggerNames_.clear();
+    triggerMatch_.clear();
+    triggerVersion_.clear();
+    triggerDr_.clear();
+    triggerHltps_.clear();
+    triggerDefaults_.clear();
+
+    // parts of the output (see SetMaxOutputSize)
+    outputParts_.clear();
+    outputPartEntries_.clear();
+    partFirstEntry_ = 0;
+
+    // event ledger for the worker processes of ScanChainParallel
+    ledgerTree_ = NULL;
+    if (writeLedger_)
+        BookLedger();
+
+    // reduced precision floats (see SetFloatPrecision); the members hold their
+    // defaults, which are kept exact
+    InitBabyNtuple();
+    quantizedBranches_.clear();
+
+    // branches of the selected groups (see myBabyBranches.h)
+#define BABY_BRANCH(type, member, branch, value, group) if (BookAsBranch(group)) {BookBabyBranch(babyTree_, branch, &member, BasketSize(group)); AddQuantizedBranch(quantizedBranches_, branch, &member, floatMantissaBits_.at(GroupIndex(group)), floatQuanta_.at(GroupIndex(group)));}
+#define BABY_VARIABLE(type, member, value, group)
+#define BABY_FLAG(member, branch, group) if (BranchGroupSelected(group)) BookBabyFlag(branch, &member, group);
+#define BABY_TRIGGER(trigger, group) if (compactTriggers_ && BranchGroupSelected(group)) RegisterTrigger(#trigger "_vstar", &trigger##_vstar_, &trigger##_version_, &dr_##trigger##_vstar_, &hltps_##trigger##_vstar_);
+#include "myBabyBranches.h"
+
+    if (!selectionBits2012_.empty())
+        babyTree_->Branch("selections2012", &selections2012_, BasketSize(kBabySelections2012));
+    if (!selectionBits2011_.empty())
+        babyTree_->Branch("selections2011", &selections2011_, BasketSize(kBabySelections2011));
+
+    // the compact trigger block has the basket size of the 2012 triggers
+    if (!triggerNames_.empty())
+    {
+        const Int_t basketSize = BasketSize(kBabyTriggers2012);
+        babyTree_->Branch("ntrigs"      , &ntrigs_      , "ntrigs/I"               , basketSize);
+        babyTree_->Branch("trig_id"     , trig_id_      , "trig_id[ntrigs]/b"      , basketSize);
+        babyTree_->Branch("trig_match"  , trig_match_   , "trig_match[ntrigs]/B"   , basketSize);
+        babyTree_->Branch("trig_version", trig_version_ , "trig_version[ntrigs]/I" , basketSize);
+        babyTree_->Branch("trig_hltps"  , trig_hltps_   , "trig_hltps[ntrigs]/I"   , basketSize);
+        babyTree_->Branch("trig_dr"     , trig_dr_      , "trig_dr[ntrigs]/F"      , basketSize);
+    }
+
+    // compile the fake rate selections
+    BookFakeRates();
+}
+
+// accepted events and their first baby row, in the baby file
+// (for the merge of ScanChainParallel and to resume from the journal)
+void myBabyMaker::BookLedger()
+{
+    babyFile_->cd();
+    ledgerTree_ = new TTree("ledger", "Accepted events and their first baby row");
+    ledgerTree_->Branch("run"         , &ledger_run_          );
+    ledgerTree_->Branch("ls"          , &ledger_ls_           );
+    ledgerTree_->Branch("evt"         , &ledger_evt_          );
+    ledgerTree_->Branch("is_real_data", &ledger_is_real_data_ );
+    ledgerTree_->Branch("first_row"   , &ledger_first_row_    );
+}
+
+// copy the event level quantities into the baby
+void myBabyMaker::FillEventInformation(const EventContext& eventContext)
+{
+    run_            = eventContext.run;
+    ls_             = eventContext.ls;
+    evt_            = eventContext.evt;
+    weight_         = eventContext.weight;
+    dataset_idx_    = NameIndex(datasetNames_, eventContext.dataset.Data());
+    is_real_data_   = eventContext.is_real_data;
+    pu_nPUvertices_ = eventContext.pu_nPUvertices;
+    pu_nPUtrueint_  = eventContext.pu_nPUtrueint;
+    evt_nvtxs_      = eventContext.evt_nvtxs;
+    pfmet_          = eventContext.pfmet;
+    pfmetphi_       = eventContext.pfmetphi;
+    rho_            = eventContext.rho;
+}
+
+// number of additional objects besides the FO under consideration
+// (only objects of the same flavour as the FO can be the FO itself)
+void myBabyMaker::FillEventCounts(const EventContext& eventContext, int eormu, unsigned int iLep)
+{
+    const int skip_el = (eormu == 11) ? static_cast<int>(iLep) : -1;
+    const int skip_mu = (eormu == 13) ? static_cast<int>(iLep) : -1;
+
+    nFOels_   = eventContext.foels.Count(skip_el);
+    ngsfs_    = eventContext.gsfs.Count(skip_el);
+    nvetoels_ = eventContext.vetoels.Count(skip_el);
+    nFOmus_   = eventContext.fomus.Count(skip_mu);
+    nmus_     = eventContext.mus.Count(skip_mu);
+    nvetomus_ = eventContext.vetomus.Count(skip_mu);
+
+    const int iel = eventContext.foels.Leading(skip_el);
+    if (iel >= 0)
+    {
+        foel_p4_ = cms2.els_p4().at(iel);
+        foel_id_ = 11*cms2.els_charge().at(iel);
+    }
+    const int imu = eventContext.fomus.Leading(skip_mu);
+    if (imu >= 0)
+    {
+        fomu_p4_ = cms2.mus_p4().at(imu);
+        fomu_id_ = 13*cms2.mus_charge().at(imu);
+    }
+}
+
+// jet variables for the lepton lep_p4: one pass over the jets of the event
+void myBabyMaker::FillJetVariables(const PFJetCache& jets, const LorentzVector& lep_p4, float deltaRCut, float deltaPhiCut, int btagLevel)
+{
+    const float lep_eta = lep_p4.eta();
+    const float lep_phi = lep_p4.phi();
+
+    // PF Jets
+    ptpfj1_       = -999.0;
+    ptpfj1_b2b_   = -999.0;
+    dphipfj1_b2b_ = -999.0;
+    npfj1_        = 0;
+
+    // L2L3 PF Jets
+    ptpfcj1_       = -999.0; 
+    ptpfcj1_b2b_   = -999.0;
+    dphipfcj1_b2b_ = -999.0;
+    npfcj1_        = 0;
+    btagpfc_       = jets.btag_L2L3;
+
+    // L1FastL2L3 PF Jets
+    emfpfcL1Fj1_      = -999.0;
+    ptpfcL1Fj1_       = -999.0;
+    dphipfcL1Fj1_     = -999.0;
+    ptpfcL1Fj1_b2b_   = -999.0;
+    dphipfcL1Fj1_b2b_ = -999.0;
+    npfcL1Fj1_        = 0;
+    npfc30L1Fj1_      = 0;
+    npfc40L1Fj1_      = 0;
+    nbpfc40L1Fj1_     = 0;
+    npfc50L1Fj1_eth_  = 0;
+    npfc65L1Fj1_eth_  = 0;
+    btagpfcL1F_       = jets.btag_L1F;
+
+    // L1FastL2L3Residual PF Jets
+    emfpfcL1Fj1res_      = -999.0;
+    ptpfcL1Fj1res_       = -999.0;
+    dphipfcL1Fj1res_     = -999.0;
+    ptpfcL1Fj1res_b2b_   = -999.0;
+    dphipfcL1Fj1res_b2b_ = -999.0;
+    npfcL1Fj1res_        = 0;
+    npfc30L1Fj1res_      = 0;
+    npfc40L1Fj1res_      = 0;
+    nbpfc40L1Fj1res_     = 0;
+    npfc50L1Fj1res_eth_  = 0;
+    npfc65L1Fj1res_eth_  = 0;
+    btagpfcL1Fres_       = jets.btag_L1Fres;
+
+    // B-tagged L1FastL2L3 and L1FastL2L3Residual PF Jets
+    ptbtagpfcL1Fj1_       = -999.0;
+    dphibtagpfcL1Fj1_     = -999.0;
+    ptbtagpfcL1Fj1res_    = -999.0;
+    dphibtagpfcL1Fj1res_  = -999.0;
+
+    for (unsigned int iJet = 0; iJet < jets.size(); iJet++)
+    {
+        // PF Jets (no jet ID)
+        // Find the highest Pt pfjet separated by at least dRcut from this lepton and fill the pfjet Pt
+        double dr = jets.DeltaR(PFJetCache::RAW, iJet, lep_eta, lep_phi);
+        float jpt = jets.pt[PFJetCache::RAW][iJet];
+        if( dr > deltaRCut && jpt > 10 ) npfj1_++;
+        if ( dr > deltaRCut && jpt > ptpfj1_ ){
+            ptpfj1_ = jpt;
+
+            // back to back in phi
+            float dphi = fabs( jets.DeltaPhi(PFJetCache::RAW, iJet, lep_phi) );
+            if( dphi > deltaPhiCut && jpt > ptpfj1_b2b_ ){ 
+                ptpfj1_b2b_   = jpt;
+                dphipfj1_b2b_ = dphi;
+            }
+        }
+
+        // the corrected jets need the jet ID
+        if (!jets.id[iJet]) continue;
+        const bool btagged = (jets.csv[iJet] >= 0.679);
+
+        // L2L3 PF Jets
+        // Find the highest Pt PF L2L3 corrected jet separated by at least dRcut from this lepton and fill the jet Pt
+        dr  = jets.DeltaR(PFJetCache::L2L3, iJet, lep_eta, lep_phi);
+        jpt = jets.pt[PFJetCache::L2L3][iJet];
+        if( dr > deltaRCut && jpt > 10 ) npfcj1_++;
+        if ( dr > deltaRCut && jpt > ptpfcj1_ ){
+            ptpfcj1_ = jpt;
+
+            // back to back in phi
+            float dphi = fabs( jets.DeltaPhi(PFJetCache::L2L3, iJet, lep_phi) );
+            if( dphi > deltaPhiCut && jpt > ptpfcj1_b2b_ ){
+                ptpfcj1_b2b_   = jpt;
+                dphipfcj1_b2b_ = dphi;
+            } 
+        }
+
+        // L1FastL2L3 PF Jets
+        // Find the highest Pt PF L1FastL2L3 corrected jet separated by at least dRcut from this lepton and fill the jet Pt
+        dr  = jets.DeltaR(PFJetCache::L1F, iJet, lep_eta, lep_phi);
+        jpt = jets.pt[PFJetCache::L1F][iJet];
+        if( dr > deltaRCut && jpt > 10 ) npfcL1Fj1_++;
+        if( dr > deltaRCut && jpt > 30 ) npfc30L1Fj1_++;
+        if( dr > deltaRCut && jpt > 40 ) npfc40L1Fj1_++;
+        if( dr > deltaRCut && jpt > 40 && jets.csv[iJet] > 0.679) nbpfc40L1Fj1_++;
+        if (dr > 0.4       && jpt > 50 ) npfc50L1Fj1_eth_++;
+        if (dr > 0.4       && jpt > 65 ) npfc65L1Fj1_eth_++;
+        if ( dr > deltaRCut && jpt > ptpfcL1Fj1_ ){
+            emfpfcL1Fj1_ = jets.emf[iJet];
+            ptpfcL1Fj1_ = jpt;
+            float dphi = fabs( jets.DeltaPhi(PFJetCache::L1F, iJet, lep_phi) );
+            dphipfcL1Fj1_ = dphi;
+
+            // back to back in phi
+            if( dphi > deltaPhiCut && jpt > ptpfcL1Fj1_b2b_ ){
+                ptpfcL1Fj1_b2b_   = jpt;
+                dphipfcL1Fj1_b2b_ = dphi;
+            }
+        }
+
+        // *** Doing B-tagging correctly ***
+        // Find the highest Pt B-tagged PF L1FastL2L3 corrected jet separated by at least dRcut from this lepton and fill the jet Pt
+        if ( btagged && dr > deltaRCut && jpt > ptbtagpfcL1Fj1_ ){
+            ptbtagpfcL1Fj1_ = jpt;
+            dphibtagpfcL1Fj1_ = fabs( jets.DeltaPhi(PFJetCache::L1F, iJet, lep_phi) );
+        }
+
+        // L1FastL2L3Residual PF Jets
+        // Find the highest Pt PF L1FastL2L3Residual corrected jet separated by at least dRcut from this lepton and fill the jet Pt
+        dr  = jets.DeltaR(PFJetCache::L1FRES, iJet, lep_eta, lep_phi);
+        jpt = jets.pt[PFJetCache::L1FRES][iJet];
+        if( dr > deltaRCut && jpt > 10 ) npfcL1Fj1res_++;
+        if( dr > deltaRCut && jpt > 30 ) npfc30L1Fj1res_++;
+        if( dr > deltaRCut && jpt > 40 ) npfc40L1Fj1res_++;
+        if( dr > deltaRCut && jpt > 40 && jets.csv[iJet] > 0.679) nbpfc40L1Fj1res_++;
+        if (dr > 0.4       && jpt > 50 ) npfc50L1Fj1res_eth_++;
+        if (dr > 0.4       && jpt > 65 ) npfc65L1Fj1res_eth_++;
+        if ( dr > deltaRCut && jpt > ptpfcL1Fj1res_ ){
+            emfpfcL1Fj1res_ = jets.emf[iJet];
+            ptpfcL1Fj1res_ = jpt;
+            float dphi = fabs( jets.DeltaPhi(PFJetCache::L1FRES, iJet, lep_phi) );
+            dphipfcL1Fj1res_ = dphi;
+
+            // back to back in phi
+            if( dphi > deltaPhiCut && jpt > ptpfcL1Fj1res_b2b_ ){
+                ptpfcL1Fj1res_b2b_   = jpt;
+                dphipfcL1Fj1res_b2b_ = dphi;
+            }
+        }
+
+        // *** Doing B-tagging correctly ***
+        // Find the highest Pt B-tagged PF L1FastL2L3Residual corrected jet separated by at least dRcut from this lepton and fill the jet Pt
+        if ( btagged && dr > deltaRCut && jpt > ptbtagpfcL1Fj1res_ ){
+            ptbtagpfcL1Fj1res_ = jpt;
+            dphibtagpfcL1Fj1res_ = fabs( jets.DeltaPhi(PFJetCache::L1FRES, iJet, lep_phi) );
+        }
+    }
+
+    // btag info: dR between the lepton and the b-tagged jets at the requested correction level
+    nbpfcjet_   = jets.bjets.size();
+    dRbpfcNear_ = 99.;
+    dRbpfcFar_  = -99.;
+    for (int ii=0; ii<nbpfcjet_; ii++) {
+        unsigned int iJet = jets.bjets.at(ii);
+        float dr = jets.DeltaR(btagLevel, iJet, lep_eta, lep_phi);
+        if (dr < dRbpfcNear_) dRbpfcNear_ = dr;
+        if (dr > dRbpfcFar_)   dRbpfcFar_  = dr;
+    }
+}
+
+// Fill the baby
+void myBabyMaker::FillBabyNtuple()
+{ 
+    if (!quantizedBranches_.empty())
+    {
+        QuantizeFloats();
+    }
+
+    // selection flags into their bit words
+    if (!packedFlags_.empty())
+    {
+        selections2012_ = 0;
+        selections2011_ = 0;
+        for (unsigned int ibit = 0; ibit < packedFlags_.size(); ibit++)
+        {
+            if (*packedFlags_[ibit])
+                *packedWords_[ibit] |= packedMasks_[ibit];
+        }
+    }
+
+    // the triggers that fired (match code != 0) into the compact trigger block
+    if (!triggerNames_.empty())
+    {
+        ntrigs_ = 0;
+        for (unsigned int itrig = 0; itrig < triggerNames_.size(); itrig++)
+        {
+            if (*triggerMatch_[itrig] == 0)
+                continue;
+            trig_id_[ntrigs_]      = itrig;
+            trig_match_[ntrigs_]   = *triggerMatch_[itrig];
+            trig_version_[ntrigs_] = *triggerVersion_[itrig];
+            trig_hltps_[ntrigs_]   = *triggerHltps_[itrig];
+            trig_dr_[ntrigs_]      = *triggerDr_[itrig];
+            ++ntrigs_;
+        }
+    }
+    FillBabyRow();
+}
+
+void myBabyMaker::FillBabyRow()
+{
+    if (!fakeRates_.empty())
+    {
+        FillFakeRates();
+    }
+    if (writeBaby_)
+    {
+        babyTree_->Fill();
+    }
+}
+
+// The rows read back from a baby (merge, resume) have the selection flags
+// and the triggers only in their packed forms: unpack them for the fake rate
+// cuts.  The triggers not in the compact block did not fire and get their defaults.
+void myBabyMaker::UnpackBabyRow()
+{
+    for (unsigned int ibit = 0; ibit < packedFlags_.size(); ibit++)
+    {
+        *packedFlags_[ibit] = (*packedWords_[ibit] & packedMasks_[ibit]) != 0;
+    }
+    if (!triggerNames_.empty())
+    {
+        for (unsigned int itrig = 0; itrig < triggerNames_.size(); itrig++)
+        {
+            *triggerMatch_[itrig]   = triggerDefaults_[itrig].match;
+            *triggerVersion_[itrig] = triggerDefaults_[itrig].version;
+            *triggerHltps_[itrig]   = triggerDefaults_[itrig].hltps;
+            *triggerDr_[itrig]      = triggerDefaults_[itrig].dr;
+        }
+        for (Int_t i = 0; i < ntrigs_; i++)
+        {
+            const unsigned int itrig = trig_id_[i];
+            *triggerMatch_[itrig]   = trig_match_[i];
+            *triggerVersion_[itrig] = trig_version_[i];
+            *triggerHltps_[itrig]   = trig_hltps_[i];
+            *triggerDr_[itrig]      = trig_dr_[i];
+        }
+    }
+}
+
+// Compile the selections of the fake rates over the baby variables and book
+// their histograms (not attached to the output file, which can roll over).
+void myBabyMaker::BookFakeRates()
+{
+    // only the groups computed in the event loop (see SetBranchGroups)
+    cutVariables_.clear();
+#define BABY_BRANCH(type, member, branch, value, group) if (BranchGroupSelected(group)) AddCutVariable(cutVariables_, branch, &member);
+#define BABY_VARIABLE(type, member, value, group)
+#define BABY_FLAG(member, branch, group) if (BranchGroupSelected(group)) AddCutVariable(cutVariables_, branch, &member);
+#include "myBabyBranches.h"
+
+    for (unsigned int ifr = 0; ifr < fakeRates_.size(); ifr++)
+    {
+        FakeRateDefinition& fr = fakeRates_[ifr];
+        fr.numeratorCut   = BabyCut(fr.numerator  , cutVariables_);
+        fr.denominatorCut = BabyCut(fr.denominator, cutVariables_);
+        fr.selectionCut   = BabyCut(fr.cuts       , cutVariables_);
+
+        const char* label = fr.label.c_str();
+        const int nEta = fr.etaBins.size() - 1;
+        const int nPt  = fr.ptBins.size()  - 1;
+        delete fr.num;
+        delete fr.den;
+        delete fr.num1;
+        delete fr.den1;
+        fr.num  = new TH2F(Form("%s_num" , label), Form("%s_num" , label), nEta, &fr.etaBins[0], nPt, &fr.ptBins[0]);
+        fr.den  = new TH2F(Form("%s_den" , label), Form("%s_den" , label), nEta, &fr.etaBins[0], nPt, &fr.ptBins[0]);
+        fr.num1 = new TH1F(Form("%s_num1", label), Form("%s_num1", label), nPt, &fr.ptBins[0]);
+        fr.den1 = new TH1F(Form("%s_den1", label), Form("%s_den1", label), nPt, &fr.ptBins[0]);
+        fr.num ->SetDirectory(NULL);
+        fr.den ->SetDirectory(NULL);
+        fr.num1->SetDirectory(NULL);
+        fr.den1->SetDirectory(NULL);
+    }
+}
+
+// the current row into the fake rate histograms
+void myBabyMaker::FillFakeRates()
+{
+    const Float_t abs_eta = fabs(eta_);
+    for (unsigned int ifr = 0; ifr < fakeRates_.size(); ifr++)
+    {
+        FakeRateDefinition& fr = fakeRates_[ifr];
+        if (!fr.selectionCut.Pass())
+            continue;
+        if (fr.denominatorCut.Pass())
+        {
+            fr.den ->Fill(abs_eta, pt_);
+            fr.den1->Fill(pt_);
+        }
+        if (fr.numeratorCut.Pass())
+        {
+            fr.num ->Fill(abs_eta, pt_);
+            fr.num1->Fill(pt_);
+        }
+    }
 }
 
-// muons only
-Float_t EffectiveArea_em(float eta, float cone_size, bool use_tight)
+// the fake rate histograms and the fake rates into the (last) output file
+void myBabyMaker::WriteFakeRates()
 {
-    float etaAbs = fabs(eta);
-    float eff_area = 0.0;
+    TFile* file = babyTree_->GetCurrentFile();
+    for (unsigned int ifr = 0; ifr < fakeRates_.size(); ifr++)
+    {
+        FakeRateDefinition& fr = fakeRates_[ifr];
+        TH2F* rate = static_cast<TH2F*>(fr.den->Clone(Form("%s_fr", fr.label.c_str())));
+        rate->SetTitle(rate->GetName());
+        rate->Reset();
+        rate->Sumw2();
+        rate->Divide(fr.num, fr.den, 1., 1., "B");
+
+        file->WriteTObject(fr.num );
+        file->WriteTObject(fr.den );
+        file->WriteTObject(fr.num1);
+        file->WriteTObject(fr.den1);
+        file->WriteTObject(rate   );
+        cout << "[FR baby maker]: fake rate " << fr.label << ": " << fr.num->GetEntries() << " / " << fr.den->GetEntries() << " numerator / denominator entries" << endl;
+
+        delete rate;
+        delete fr.num;
+        delete fr.den;
+        delete fr.num1;
+        delete fr.den1;
+        fr.num  = NULL;
+        fr.den  = NULL;
+        fr.num1 = NULL;
+        fr.den1 = NULL;
+    }
+}
 
-    if (abs(cone_size - 0.3) < 0.01)
+// Round the reduced precision floats in place.  The defaults stay exact so
+// that cuts like x != -999. keep working.
+void myBabyMaker::QuantizeFloats()
+{
+    for (unsigned int ibranch = 0; ibranch < quantizedBranches_.size(); ibranch++)
     {
-        if (use_tight)
+        QuantizedBranch& branch = quantizedBranches_[ibranch];
+        if (branch.value)
         {
-            if (etaAbs < 1.0)      eff_area = 0.118;
-            else if (etaAbs < 1.5) eff_area = 0.053;
-            else if (etaAbs < 2.0) eff_area = 0.015;
-            else if (etaAbs < 2.2) eff_area = 0.112;
-            else if (etaAbs < 2.3) eff_area = 0.302;
-            else if (etaAbs < 2.4) eff_area = 0.251;
+            if (*branch.value != branch.sentinel)
+                *branch.value = QuantizeFloat(branch, *branch.value);
         }
         else
         {
-            if (etaAbs < 1.0)      eff_area = 0.274;
-            else if (etaAbs < 1.5) eff_area = 0.161;
-            else if (etaAbs < 2.0) eff_area = 0.079;
-            else if (etaAbs < 2.2) eff_area = 0.168;
-            else if (etaAbs < 2.3) eff_area = 0.359;
-            else if (etaAbs < 2.4) eff_area = 0.294;
+            LorentzVector& p4 = *branch.p4;
+            p4.SetPxPyPzE(QuantizeFloat(branch, p4.Px()), QuantizeFloat(branch, p4.Py()), QuantizeFloat(branch, p4.Pz()), QuantizeFloat(branch, p4.E()));
         }
     }
-    else if (abs(cone_size - 0.4) < 0.01)
+}
+
+// The rows copied from a worker output or from the baby of a resumed job were
+// rounded when they were made: their largest errors are taken from the table
+// written with them (see WriteBabyMetadata).
+void myBabyMaker::ReadQuantizationErrors(TDirectory* dir)
+{
+    const std::vector<std::string> lines = baby_metadata::ReadNames(dir, baby_metadata::kQuantizationErrors);
+    for (unsigned int iline = 0; iline < lines.size(); iline++)
     {
-        if (use_tight)
+        std::istringstream fields(lines[iline]);
+        std::string name;
+        Double_t maxAbsError = 0, maxRelError = 0;
+        if (!(fields >> name >> maxAbsError >> maxRelError))
+            throw std::logic_error(Form("[FR baby maker]: ReadQuantizationErrors - cannot parse '%s' in %s", lines[iline].c_str(), dir->GetName()));
+        for (unsigned int ibranch = 0; ibranch < quantizedBranches_.size(); ibranch++)
         {
-            if (etaAbs < 1.0)      eff_area = 0.200;
-            else if (etaAbs < 1.5) eff_area = 0.109;
-            else if (etaAbs < 2.0) eff_area = 0.087;
-            else if (etaAbs < 2.2) eff_area = 0.184;
-            else if (etaAbs < 2.3) eff_area = 0.425;
-            else if (etaAbs < 2.4) eff_area = 0.350;
-        }
-        else
-        {
-            if (etaAbs < 1.0)      eff_area = 0.504;
-            else if (etaAbs < 1.5) eff_area = 0.306;
-            else if (etaAbs < 2.0) eff_area = 0.198;
-            else if (etaAbs < 2.2) eff_area = 0.287;
-            else if (etaAbs < 2.3) eff_area = 0.525;
-            else if (etaAbs < 2.4) eff_area = 0.488;
+            QuantizedBranch& branch = quantizedBranches_[ibranch];
+            if (branch.name != name)
+                continue;
+            branch.maxAbsError = std::max(branch.maxAbsError, maxAbsError);
+            branch.maxRelError = std::max(branch.maxRelError, maxRelError);
         }
     }
-
-    // done
-    return eff_area;
 }
 
-
-
-//------------------------------------------
-// Initialize baby ntuple variables
-//------------------------------------------
-void myBabyMaker::InitBabyNtuple() 
+// Add a trigger to the compact trigger block.  Its id is the order of
+// registration; the names are written to the output (see BabyMetadata.h).
+void myBabyMaker::RegisterTrigger(const char* name, Int_t* match, Int_t* version, Float_t* dr, Int_t* hltps)
 {
-    /////////////////////////// 
-    // Event Information     //
-    ///////////////////////////
-    
-    // Basic Event Information
-    run_          = -1;
-    ls_           = -1;
-    evt_          = 0;
-    weight_       = 1.0;
-    dataset_      = "";
-    filename_     = "";
-    is_real_data_ = false;
-  
-    // Pileup - PUSummaryInfoMaker
-    pu_nPUvertices_ = -1;
-    pu_nPUtrueint_  = -1.0;
-  
-    // Pileup - VertexMaker
-    evt_nvtxs_ = -1;
-
-    // event level variables
-    nFOels_ = 0;
-    nFOmus_ = 0;
-    ngsfs_  = 0;
-    nmus_   = 0;
-    nvetomus_ = 0;
-    nvetoels_ = 0;
-
-    /////////////////////////// 
-    // End Event Information //
-    ///////////////////////////
-
-
-    //////////////////////////// 
-    // Lepton Information     //
-    ////////////////////////////
-
-    id_       = -1;
-    pt_       = -999.;
-    eta_      = -999.;
-    sceta_    = -999.;
-    phi_      = -999.;
-    scet_     = -999.;
-    pfmet_    = -999.;
-    pfmetphi_ = -999.;
-    hoe_      = -999.;
-    d0_       = -999.;
-    dz_       = -999.;
-    ip3d_     = -999.;
-    d0err_    = -999.;
-    dzerr_    = -999.;
-    ip3derr_  = -999.;
-
-    lp4_.SetCoordinates(0,0,0,0);     // 4-vector of the lepton
-    foel_p4_.SetCoordinates(0,0,0,0); // 4-vector of the highest pt additional FO in the event
-    fomu_p4_.SetCoordinates(0,0,0,0); // 4-vector of the highest pt additional FO in the event
-    foel_id_   = -999;
-    fomu_id_   = -999;
-    foel_mass_ = -999.0;
-    fomu_mass_ = -999.0;
-
-    iso_                = -999.;
-    iso_nps_            = -999.;
-    trck_iso_           = -999.;
-    ecal_iso_           = -999.;
-    ecal_iso_nps_       = -999.;
-    hcal_iso_           = -999.;
-    pfiso03_            = -999.;
-    ch_pfiso03_         = -999.;
-    nh_pfiso03_         = -999.;
-    em_pfiso03_         = -999.;
-    pfiso03_bv_         = -999.;
-    ch_pfiso03_bv_      = -999.;
-    nh_pfiso03_bv_      = -999.;
-    em_pfiso03_bv_      = -999.;
-    pfiso04_            = -999.;
-    ch_pfiso04_         = -999.;
-    nh_pfiso04_         = -999.;
-    em_pfiso04_         = -999.;
-    pfiso04_bv_         = -999.;
-    ch_pfiso04_bv_      = -999.;
-    nh_pfiso04_bv_      = -999.;
-    em_pfiso04_bv_      = -999.;
-    radiso_et1p0_       = -999.;
-    ch_radiso_et1p0_    = -999.;
-    nh_radiso_et1p0_    = -999.;
-    em_radiso_et1p0_    = -999.;
-    radiso_et0p5_       = -999.;
-    ch_radiso_et0p5_    = -999.;
-    nh_radiso_et0p5_    = -999.;
-    em_radiso_et0p5_    = -999.;
-    radiso_et1p0_bv_    = -999.;
-    ch_radiso_et1p0_bv_ = -999.;
-    nh_radiso_et1p0_bv_ = -999.;
-    em_radiso_et1p0_bv_ = -999.;
-    radiso_et0p5_bv_    = -999.;
-    ch_radiso_et0p5_bv_ = -999.;
-    nh_radiso_et0p5_bv_ = -999.;
-    em_radiso_et0p5_bv_ = -999.;
-    pfpupt03_           = -999.;
-    pfpupt04_           = -999.;
-    cpfiso03_rho_       = -999.;
-    cpfiso04_rho_       = -999.;
-    cpfiso03_db_        = -999.;
-
-    closestMuon_      = false;
-    el_id_sieie_      = -999.;
-    el_id_detain_     = -999.;
-    el_id_dphiin_     = -999.;
-    el_id_smurfV5_    = false;
-    el_id_vbtf80_     = false;
-    el_id_vbtf90_     = false;
-    convHitPattern_   = false;
-    convPartnerTrack_ = false;
-    convMIT_          = false;
-    conv0MissHits_    = false;
-
-    el_effarea03_          = -999.;
-    el_effarea04_          = -999.;
-    mu_effarea03_          = -999.;
-    mu_nh_effarea03_       = -999.;
-    mu_em_effarea03_       = -999.;
-    mu_effarea03_tight_    = -999.;
-    mu_nh_effarea03_tight_ = -999.;
-    mu_em_effarea03_tight_ = -999.;
-    mu_effarea04_          = -999.;
-    mu_nh_effarea04_       = -999.;
-    mu_em_effarea04_       = -999.;
-    mu_effarea04_tight_    = -999.;
-    mu_nh_effarea04_tight_ = -999.;
-    mu_em_effarea04_tight_ = -999.;
-
-
-    // Z mass variables
-    mz_fo_gsf_       = -999.;
-    mz_gsf_iso_      = -999.;
-    mz_fo_ctf_       = -999.;
-    mz_ctf_iso_      = -999.;
-    mupsilon_fo_mu_  = -999.;
-    mupsilon_mu_iso_ = -999.;
-
-    d0PV_wwV1_       = -999.;
-    dzPV_wwV1_       = -999.;
-
-    mu_isCosmic_ = false;
-
-    mu_ecal_veto_dep_ = -999.;
-    mu_hcal_veto_dep_ = -999.;
-    mu_nchi2_         = -999.;
-
-    mt_                   = -999;
-    pfmt_                 = -999;
-    q3_                   = false;
-    els_exp_innerlayers_  = 999;
-    mcid_                 = 0;
-    mcmotherid_           = 0;
-      
-    // HT
-#ifndef __CMS2_SLIM__
-    ht_calo_          = -999;           
-    ht_calo_L2L3_     = -999;      
-#endif
-    ht_pf_            = -999;            
-    ht_pf_L2L3_       = -999;        
-    ht_pf_L1FastL2L3_ = -999;
-
-    // MC truth information
-    mc3id_         = -999;
-    mc3pt_         = -999.;
-    mc3dr_         = -999.;
-    mc3p4_.SetCoordinates(0,0,0,0);
-    leptonIsFromW_ = -999;
-
-    //////////////////////////// 
-    // End Lepton Information //
-    ////////////////////////////
-
+    if (triggerNames_.size() == static_cast<unsigned int>(kMaxBabyTriggers))
+    {
+        throw std::logic_error(Form("[FR baby maker]: too many triggers in the compact trigger block (%s)", name));
+    }
+    triggerNames_.push_back(name);
+    triggerMatch_.push_back(match);
+    triggerVersion_.push_back(version);
+    triggerDr_.push_back(dr);
+    triggerHltps_.push_back(hltps);
+
+    // the members hold their defaults while the baby is booked
+    TriggerDefaults defaults = {*match, *version, *dr, *hltps};
+    triggerDefaults_.push_back(defaults);
+}
 
+// Book a selection flag.  With SetPackSelections, the flag is the next bit of
+// the word of its group instead, and an alias with the flag name keeps the
+// cut strings working, e.g. num_el_ssV7 -> ((selections2012>>0)&1).
+// The flag names of the bits are written to the output (see BabyMetadata.h).
+void myBabyMaker::BookBabyFlag(const char* branch, Bool_t* flag, unsigned int group)
+{
+    if (!packSelections_)
+    {
+        babyTree_->Branch(branch, flag, BasketSize(group));
+        return;
+    }
 
-    //////////////////////////////////////////////////////
-    // Fake Rate Numerator & Denominator Selections     //
-    //////////////////////////////////////////////////////
+    const bool is2011 = (group == kBabySelections2011);
+    std::vector<std::string>& bits = is2011 ? selectionBits2011_ : selectionBits2012_;
+    // the aliases, BabyMetadata::SelectionCut and BabyCut read the word as a
+    // double, which holds the integers exactly up to 2^53 only
+    if (bits.size() == 53)
+    {
+        throw std::logic_error(Form("[FR baby maker]: no bit left for selection flag %s (the words are read as doubles: 53 bits at most)", branch));
+    }
 
-    //////////
-    // 2012 //
-    //////////
+    babyTree_->SetAlias(branch, Form("((%s>>%u)&1)", is2011 ? "selections2011" : "selections2012", static_cast<unsigned int>(bits.size())));
+    packedFlags_.push_back(flag);
+    packedWords_.push_back(is2011 ? &selections2011_ : &selections2012_);
+    packedMasks_.push_back(1ULL << bits.size());
+    bits.push_back(branch);
+}
 
-    // SS
+// Close the baby
+void myBabyMaker::CloseBabyNtuple()
+{
+    babyFile_ = babyTree_->GetCurrentFile();
+    babyFile_->cd();
+    outputParts_.push_back(babyFile_->GetName());
+    outputPartEntries_.push_back(babyTree_->GetEntries() - partFirstEntry_);
+    if (writeBaby_)
+    {
+        babyTree_->Write();
+        WriteBabyMetadata();
+    }
+    WriteFakeRates();
+    if (compressionReport_)
+    {
+        PrintCompressionReport();
+    }
+    if (ledgerTree_)
+    {
+        ledgerTree_->Write();
+        ledgerTree_ = NULL;
+    }
+    babyFile_->Close();
 
-    // Electrons
-    num_el_ssV7_       = false;
-    num_el_ssV7_noIso_ = false;
-    v1_el_ssV7_        = false;
-    v2_el_ssV7_        = false;
-    v3_el_ssV7_        = false;
-    
-    // Muons
-    num_mu_ssV5_       = false;        
-    num_mu_ssV5_noIso_ = false;  
-    fo_mu_ssV5_        = false;         
-    fo_mu_ssV5_noIso_  = false;   
-
-    // TTZ
-
-    // Electrons
-    num_el_TTZcuttightv1_       = false;
-    num_el_TTZcuttightv1_noIso_ = false;
-    fo_el_TTZcuttightv1_        = false;
-    fo_el_TTZcuttightv1_noIso_  = false;
-
-    num_el_TTZcutloosev1_       = false;
-    num_el_TTZcutloosev1_noIso_ = false;
-    fo_el_TTZcutloosev1_        = false;
-    fo_el_TTZcutloosev1_noIso_  = false;
-
-    num_el_TTZMVAtightv1_       = false;
-    num_el_TTZMVAtightv1_noIso_ = false;
-    fo_el_TTZMVAtightv1_        = false;
-    fo_el_TTZMVAtightv1_noIso_  = false;
-
-    num_el_TTZMVAloosev1_       = false;
-    num_el_TTZMVAloosev1_noIso_ = false;
-    fo_el_TTZMVAloosev1_        = false;
-    fo_el_TTZMVAloosev1_noIso_  = false;
-
-    // Muons
-    num_mu_TTZtightv1_       = false;
-    num_mu_TTZtightv1_noIso_ = false;
-    fo_mu_TTZtightv1_        = false;
-    fo_mu_TTZtightv1_noIso_  = false;
-
-    num_mu_TTZloosev1_       = false;
-    num_mu_TTZloosev1_noIso_ = false;
-    fo_mu_TTZloosev1_        = false;
-    fo_mu_TTZloosev1_noIso_  = false;
-
-
-
-    //////////
-    // 2011 //
-    //////////
-
-    // SS
-
-    // Electrons
-    num_el_ssV6_       = false;
-    num_el_ssV6_noIso_ = false;
-    v1_el_ssV6_        = false;
-    v2_el_ssV6_        = false;
-    v3_el_ssV6_        = false;
-
-    // Muons
-    numNomSSv4_      = false;
-    numNomSSv4noIso_ = false; 
-    fo_mussV4_04_    = false;
-    fo_mussV4_noIso_ = false;
-
-    // WW, HWW
-
-    // Electrons
-    num_el_smurfV6_ = false;
-    num_el_smurfV6lh_ = false;
-    v1_el_smurfV1_  = false;
-    v2_el_smurfV1_  = false;
-    v3_el_smurfV1_  = false;
-    v4_el_smurfV1_  = false;
-
-    // Muons
-    num_mu_smurfV6_ = false;
-    fo_mu_smurf_04_ = false;
-    fo_mu_smurf_10_ = false;
-
-
-    // OS
-    num_el_OSV2_  = false;
-    num_mu_OSGV2_ = false;
-    num_mu_OSZV2_ = false;
-    fo_el_OSV2_   = false;
-    fo_mu_OSGV2_  = false;
-
-    // OS
-    num_el_OSV3_  = false;
-    num_mu_OSGV3_ = false;
-    fo_el_OSV3_   = false;
-    fo_mu_OSGV3_  = false;
-    
-    //////////////////////////////////////////////////////
-    // End Fake Rate Numerator & Denominator Selections //
-    //////////////////////////////////////////////////////
-
-    ///////////////////////  
-    // 2012 Triggers     //
-    ///////////////////////
-
-    // Electrons
-    ele17_CaloIdL_CaloIsoVL_vstar_                                     = 0;
-    ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                    = 0;
-    ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_              = 0;
-    ele8_CaloIdL_CaloIsoVL_vstar_                                      = 0;
-    ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                     = 0;
-    ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_               = 0;
-    ele8_CaloIdT_TrkIdVL_vstar_                                        = 0;
-    ele8_CaloIdT_TrkIdVL_Jet30_vstar_                                  = 0;
-    ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_       = 0;
-    ele27_WP80_vstar_                                                  = 0;
-
-    ele17_CaloIdL_CaloIsoVL_version_                                   = - 1;
-    ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_                  = - 1;
-    ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_            = - 1;
-    ele8_CaloIdL_CaloIsoVL_version_                                    = - 1;
-    ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_                   = - 1;
-    ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_             = - 1;
-    ele8_CaloIdT_TrkIdVL_version_                                      = - 1;
-    ele8_CaloIdT_TrkIdVL_Jet30_version_                                = - 1;
-    ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_version_     = - 1;
-    ele27_WP80_version_                                                = - 1;
-
-    dr_ele17_CaloIdL_CaloIsoVL_vstar_                                  = 99.0;
-    dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                 = 99.0;
-    dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_           = 99.0;
-    dr_ele8_CaloIdL_CaloIsoVL_vstar_                                   = 99.0;
-    dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                  = 99.0;
-    dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_            = 99.0;
-    dr_ele8_CaloIdT_TrkIdVL_vstar_                                     = 99.0;
-    dr_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                               = 99.0;
-    dr_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_    = 99.0;
-    dr_ele27_WP80_vstar_                                               = 99.0;
-
-    hltps_ele17_CaloIdL_CaloIsoVL_vstar_                               = - 1;
-    hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_              = - 1;
-    hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_        = - 1;
-    hltps_ele8_CaloIdL_CaloIsoVL_vstar_                                = - 1;
-    hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_               = - 1;
-    hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_         = - 1;
-    hltps_ele8_CaloIdT_TrkIdVL_vstar_                                  = - 1;
-    hltps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                            = - 1;
-    hltps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_ = - 1;
-    hltps_ele27_WP80_vstar_                                            = - 1;
+    // list the parts if the output was split
+    if (outputParts_.size() > 1)
+    {
+        WriteOutputManifest();
+    }
 
-#ifndef __CMS2_SLIM__
-    l1ps_ele17_CaloIdL_CaloIsoVL_vstar_                                = - 1;
-    l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_               = - 1;
-    l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_         = - 1;
-    l1ps_ele8_CaloIdL_CaloIsoVL_vstar_                                 = - 1;
-    l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                = - 1;
-    l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_          = - 1;
-    l1ps_ele8_CaloIdT_TrkIdVL_vstar_                                   = - 1;
-    l1ps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                             = - 1;
-    l1ps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_  = - 1;
-    l1ps_ele27_WP80_vstar_                                             = - 1;
-#endif
+    // two-level layout (the worker outputs stay flat for the merge)
+    if (splitEvents_ && writeBaby_ && !writeLedger_)
+    {
+        for (unsigned int ipart = 0; ipart < outputParts_.size(); ipart++)
+        {
+            SplitEventTree(outputParts_[ipart].c_str());
+        }
+    }
+}
 
-    // Muons
-    mu5_vstar_                  = 0;
-    mu8_vstar_                  = 0;
-    mu12_vstar_                 = 0;
-    mu17_vstar_                 = 0;
-    mu15_eta2p1_vstar_          = 0;
-    mu24_eta2p1_vstar_          = 0;
-    mu30_eta2p1_vstar_          = 0;
-    isoMu20_eta2p1_vstar_       = 0;
-    isoMu24_eta2p1_vstar_       = 0;
-    isoMu30_eta2p1_vstar_       = 0;
-    relIso1p0Mu17_vstar_        = 0;
-    relIso1p0Mu20_vstar_        = 0;
-    relIso1p0Mu5_vstar_         = 0;
-
-    mu5_version_                = -1;
-    mu8_version_                = -1;
-    mu12_version_               = -1;
-    mu17_version_               = -1;
-    mu15_eta2p1_version_        = -1;
-    mu24_eta2p1_version_        = -1;
-    mu30_eta2p1_version_        = -1;
-    isoMu20_eta2p1_version_     = -1;
-    isoMu24_eta2p1_version_     = -1;
-    isoMu30_eta2p1_version_     = -1;
-    relIso1p0Mu17_version_      = -1;
-    relIso1p0Mu20_version_      = -1;
-    relIso1p0Mu5_version_       = -1;
-
-    dr_mu8_vstar_               = 99.0;
-    dr_mu5_vstar_               = 99.0;
-    dr_mu12_vstar_              = 99.0;
-    dr_mu17_vstar_              = 99.0;
-    dr_mu15_eta2p1_vstar_       = 99.0;
-    dr_mu24_eta2p1_vstar_       = 99.0;
-    dr_mu30_eta2p1_vstar_       = 99.0;
-    dr_isoMu20_eta2p1_vstar_    = 99.0;
-    dr_isoMu24_eta2p1_vstar_    = 99.0;
-    dr_isoMu30_eta2p1_vstar_    = 99.0;
-    dr_relIso1p0Mu17_vstar_     = 99.0;
-    dr_relIso1p0Mu20_vstar_     = 99.0;
-    dr_relIso1p0Mu5_vstar_      = 99.0;
-
-    hltps_mu8_vstar_            = -1;
-    hltps_mu5_vstar_            = -1;
-    hltps_mu12_vstar_           = -1;
-    hltps_mu17_vstar_           = -1;
-    hltps_mu15_eta2p1_vstar_    = -1;
-    hltps_mu24_eta2p1_vstar_    = -1;
-    hltps_mu30_eta2p1_vstar_    = -1;
-    hltps_isoMu20_eta2p1_vstar_ = -1;
-    hltps_isoMu24_eta2p1_vstar_ = -1;
-    hltps_isoMu30_eta2p1_vstar_ = -1;
-    hltps_relIso1p0Mu17_vstar_  = -1;
-    hltps_relIso1p0Mu20_vstar_  = -1;
-    hltps_relIso1p0Mu5_vstar_   = -1;
+// Rewrite the baby fileName with the event branches (kEventBranches) moved
+// to a tree "events" with one entry per event, and evt_idx, the entry of
+// the event, added to the lepton tree.  The rows of an event are adjacent,
+// so a new event starts where run, ls, evt or filename_idx change.
+// The events tree is indexed on evt_idx to be used as a friend (see BabyEvents.h).
+void myBabyMaker::SplitEventTree(const char* fileName)
+{
+    TFile* inFile = TFile::Open(fileName);
+    if (!inFile || inFile->IsZombie())
+    {
+        throw std::runtime_error(Form("[FR baby maker]: SplitEventTree - cannot open %s", fileName));
+    }
+    TTree* flat = dynamic_cast<TTree*>(inFile->Get("tree"));
+    if (!flat || inFile->Get(baby_events::kEventTree))
+    {
+        throw std::logic_error(Form("[FR baby maker]: SplitEventTree - %s has no flat baby tree", fileName));
+    }
 
-#ifndef __CMS2_SLIM__
-    l1ps_mu8_vstar_             = -1;
-    l1ps_mu5_vstar_             = -1;
-    l1ps_mu12_vstar_            = -1;
-    l1ps_mu17_vstar_            = -1;
-    l1ps_mu15_eta2p1_vstar_     = -1;
-    l1ps_mu24_eta2p1_vstar_     = -1;
-    l1ps_mu30_eta2p1_vstar_     = -1;
-    l1ps_isoMu20_eta2p1_vstar_  = -1;
-    l1ps_isoMu24_eta2p1_vstar_  = -1;
-    l1ps_isoMu30_eta2p1_vstar_  = -1;
-    l1ps_relIso1p0Mu17_vstar_   = -1;
-    l1ps_relIso1p0Mu5_vstar_    = -1;
-#endif
+    std::vector<std::string> eventBranches;
+    for (unsigned int ibranch = 0; ibranch < sizeof(kEventBranches) / sizeof(kEventBranches[0]); ibranch++)
+    {
+        if (flat->GetBranch(kEventBranches[ibranch]))
+            eventBranches.push_back(kEventBranches[ibranch]);
+    }
 
-    ///////////////////////  
-    // End 2012 Triggers //
-    ///////////////////////
-
-
-   
-  
-    ///////////////////////  
-    // 2011 Triggers     //
-    ///////////////////////
-
-    // Electrons
-    ele8_vstar_                                             = 0;
-    ele8_CaloIdL_TrkIdVL_vstar_                             = 0;
-    ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                     = 0;
-    ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_          = 0;
-    photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_    = 0;
-
-    ele8_version_                                           = -1;
-    ele8_CaloIdL_TrkIdVL_version_                           = -1;
-    ele8_CaloIdL_CaloIsoVL_Jet40_version_                   = -1;
-    ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_version_        = -1;
-    photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_version_  = -1;
-
-    dr_ele8_vstar_                                          = 99.0; 
-    dr_ele8_CaloIdL_TrkIdVL_vstar_                          = 99.0; 
-    dr_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                  = 99.0; 
-    dr_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_       = 99.0;
-    dr_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_ = 99.0; 
-
-    hltps_ele8_vstar_                                          = -1; 
-    hltps_ele8_CaloIdL_TrkIdVL_vstar_                          = -1; 
-    hltps_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                  = -1; 
-    hltps_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_       = -1;
-    hltps_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_ = -1; 
-
-    // Muons
-    mu3_vstar_          = 0;
-    mu15_vstar_         = 0;  
-    mu20_vstar_         = 0;  
-    mu24_vstar_         = 0;  
-    mu30_vstar_         = 0;  
-    mu8_Jet40_vstar_    = 0;    
-
-    mu3_version_        = -1;
-    mu15_version_       = -1;  
-    mu20_version_       = -1;  
-    mu24_version_       = -1;  
-    mu30_version_       = -1;  
-    mu8_Jet40_version_  = -1;    
-
-    dr_mu3_vstar_       = 99.0;
-    dr_mu15_vstar_      = 99.0; 
-    dr_mu20_vstar_      = 99.0; 
-    dr_mu24_vstar_      = 99.0; 
-    dr_mu30_vstar_      = 99.0;
-    dr_mu8_Jet40_vstar_ = 99.0;
-
-    hltps_mu3_vstar_       = -1;
-    hltps_mu15_vstar_      = -1; 
-    hltps_mu20_vstar_      = -1; 
-    hltps_mu24_vstar_      = -1; 
-    hltps_mu30_vstar_      = -1;
-    hltps_mu8_Jet40_vstar_ = -1;
-
-    ///////////////////////  
-    // End 2011 Triggers //
-    ///////////////////////
-
-  
-    //////////////
-    // Jets     //
-    //////////////
+    // an event is identified by the leaves of its key
+    const char* keyNames[] = {"run", "ls", "evt", "filename_idx"};
+    std::vector<TLeaf*> keyLeaves;
+    for (unsigned int ikey = 0; ikey < 4; ikey++)
+    {
+        TLeaf* leaf = flat->GetLeaf(keyNames[ikey]);
+        if (leaf)
+            keyLeaves.push_back(leaf);
+        else if (ikey < 3)
+            throw std::logic_error(Form("[FR baby maker]: SplitEventTree - no %s in %s (event branches not booked?)", keyNames[ikey], fileName));
+    }
 
-#ifndef __CMS2_SLIM__
-    // Calo Jets
-    ptj1_       = 0.;
-    ptj1_b2b_   = -999.;
-    dphij1_b2b_ = -999.;
-    nj1_        = 0;
-#endif
+    const std::string splitName = std::string(fileName) + ".split";
+    TFile* outFile = TFile::Open(splitName.c_str(), "RECREATE");
+    if (!outFile || outFile->IsZombie())
+    {
+        throw std::runtime_error(Form("[FR baby maker]: SplitEventTree - cannot create %s", splitName.c_str()));
+    }
+    outFile->SetCompressionSettings(inFile->GetCompressionSettings());
+    outFile->cd();
+
+    // the clones only get the active branches, and read them from flat
+    flat->SetBranchStatus("*", 1);
+    for (unsigned int ibranch = 0; ibranch < eventBranches.size(); ibranch++)
+        flat->SetBranchStatus(eventBranches[ibranch].c_str(), 0);
+    TTree* leptons = flat->CloneTree(0);
+
+    flat->SetBranchStatus("*", 0);
+    for (unsigned int ibranch = 0; ibranch < eventBranches.size(); ibranch++)
+        flat->SetBranchStatus(eventBranches[ibranch].c_str(), 1);
+    TTree* events = flat->CloneTree(0);
+    events->SetName(baby_events::kEventTree);
+    events->SetTitle("Events of the baby rows");
+    if (events->GetListOfAliases())
+        events->GetListOfAliases()->Delete();
+    flat->SetBranchStatus("*", 1);
+
+    Long64_t evt_idx = -1;
+    leptons->Branch(baby_events::kEventIndex, &evt_idx);
+    events->Branch(baby_events::kEventIndex, &evt_idx);
+
+    std::vector<Double_t> lastKey(keyLeaves.size(), 0);
+    const Long64_t nRows = flat->GetEntries();
+    for (Long64_t irow = 0; irow < nRows; irow++)
+    {
+        flat->GetEntry(irow);
 
-    // PF Jets
-    ptpfj1_       = 0.;
-    ptpfj1_b2b_   = -999.;
-    dphipfj1_b2b_ = -999.;
-    npfj1_        = 0;
+        bool newEvent = (irow == 0);
+        for (unsigned int ikey = 0; ikey < keyLeaves.size(); ikey++)
+        {
+            const Double_t value = keyLeaves[ikey]->GetValue();
+            newEvent = newEvent || (value != lastKey[ikey]);
+            lastKey[ikey] = value;
+        }
+        if (newEvent)
+        {
+            ++evt_idx;
+            events->Fill();
+        }
+        leptons->Fill();
+    }
+    events->BuildIndex(baby_events::kEventIndex);
 
-    // PF L2L3 Corrected jets
-    ptpfcj1_        = 0.;
-    ptpfcj1_b2b_    = -999.;
-    dphipfcj1_b2b_  = -999.;
-    npfcj1_         = 0;
-    btagpfc_        = false;
-
-    // PF L1FastL2L3 Corrected jets
-    emfpfcL1Fj1_       = -999.;
-    ptpfcL1Fj1_        = 0.;
-    dphipfcL1Fj1_      = -999.;
-    ptpfcL1Fj1_b2b_    = -999.;
-    dphipfcL1Fj1_b2b_  = -999.;
-    npfcL1Fj1_         = 0;
-    npfc30L1Fj1_       = 0;
-    npfc40L1Fj1_       = 0;
-    nbpfc40L1Fj1_      = 0;
-    btagpfcL1F_        = false;
-    npfc50L1Fj1_eth_   = 0;
-    npfc65L1Fj1_eth_   = 0;
-
-    // PF L1FastL2L3Residual Corrected jets
-    emfpfcL1Fj1res_       = -999.;
-    ptpfcL1Fj1res_        = 0.;
-    dphipfcL1Fj1res_      = -999.;
-    ptpfcL1Fj1res_b2b_    = -999.;
-    dphipfcL1Fj1res_b2b_  = -999.;
-    npfcL1Fj1res_         = 0;
-    npfc30L1Fj1res_       = 0;
-    npfc40L1Fj1res_       = 0;
-    nbpfc40L1Fj1res_      = 0;
-    btagpfcL1Fres_        = false;
-    npfc50L1Fj1res_eth_   = 0;
-    npfc65L1Fj1res_eth_   = 0;
-
-    // btag PF L1FastL2L3 Corrected jets
-    ptbtagpfcL1Fj1_        = 0.;
-    dphibtagpfcL1Fj1_      = -999.;
-    
-    // btag PF L1FastL2L3Residual Corrected jets
-    ptbtagpfcL1Fj1res_        = 0.;
-    dphibtagpfcL1Fj1res_      = -999.;
-    
-#ifndef __CMS2_SLIM__
-    // CALO Jet info
-    nbjet_  = 0;
-    dRbNear_ = 99.;
-    dRbFar_ = -99.;
-#endif
-    nbpfcjet_  = 0;
-    dRbpfcNear_ = 99.;
-    dRbpfcFar_ = -99.;
+    leptons->Write();
+    events->Write();
 
-    rho_ = -999.;
+    // name tables and the other objects of the file
+    std::set<std::string> copied;
+    TIter next(inFile->GetListOfKeys());
+    while (TKey* key = static_cast<TKey*>(next()))
+    {
+        if (std::string(key->GetClassName()) == "TTree" || !copied.insert(key->GetName()).second)
+            continue;
+        TObject* object = key->ReadObj();
+        outFile->WriteTObject(object, key->GetName(), "Overwrite");
+        delete object;
+    }
 
-    //////////////
-    // End Jets //
-    //////////////
+    cout << "[FR baby maker]: " << fileName << " split into " << nRows << " lepton rows and " << (evt_idx + 1) << " events" << endl;
+    outFile->Close();
+    inFile->Close();
+    delete outFile;
+    delete inFile;
 
+    if (rename(splitName.c_str(), fileName) != 0)
+    {
+        throw std::runtime_error(Form("[FR baby maker]: SplitEventTree - cannot replace %s with %s", fileName, splitName.c_str()));
+    }
 }
 
-// Book the baby ntuple
-void myBabyMaker::MakeBabyNtuple(const char *babyFilename)
+// Size of each branch of the baby, largest first.  The baskets are flushed
+// by the Write in CloseBabyNtuple; with SetMaxOutputSize the sizes are the
+// ones the tree keeps over all the parts.
+void myBabyMaker::PrintCompressionReport() const
 {
-    babyFile_ = TFile::Open(Form("%s", babyFilename), "RECREATE");
-    babyFile_->cd();
-    babyTree_ = new TTree("tree", "A Baby Ntuple");
+    std::vector<BranchSize> sizes;
+    TObjArray* branches = babyTree_->GetListOfBranches();
+    for (int ibranch = 0; ibranch < branches->GetEntriesFast(); ibranch++)
+    {
+        TBranch* branch = static_cast<TBranch*>(branches->At(ibranch));
+        BranchSize size;
+        size.name     = branch->GetName();
+        size.totBytes = branch->GetTotBytes("*");
+        size.zipBytes = branch->GetZipBytes("*");
+        sizes.push_back(size);
+    }
+    std::sort(sizes.begin(), sizes.end());
 
-    /////////////////////////// 
-    // Event Information     //
-    ///////////////////////////
-
-    babyTree_->Branch("run"            , &run_                );
-    babyTree_->Branch("ls"             , &ls_                 );
-    babyTree_->Branch("evt"            , &evt_                );
-    babyTree_->Branch("weight"         , &weight_             );
-    babyTree_->Branch("is_real_data"   , &is_real_data_       );
-    babyTree_->Branch("dataset"        , "TString", &dataset_ );
-    babyTree_->Branch("filename"       , "TString", &filename_);
-  
-    // Pileup
-    babyTree_->Branch("pu_nPUvertices" , &pu_nPUvertices_ );
-    babyTree_->Branch("pu_nPUtrueint"  , &pu_nPUtrueint_ );
-    babyTree_->Branch("evt_nvtxs"      , &evt_nvtxs_      );
-
-    // event level variables
-    babyTree_->Branch("nFOels"         , &nFOels_         );
-    babyTree_->Branch("nFOmus"         , &nFOmus_         );
-    babyTree_->Branch("ngsfs"          , &ngsfs_          );
-    babyTree_->Branch("nmus"           , &nmus_           );
-    babyTree_->Branch("nvetoels"       , &nvetoels_       );
-    babyTree_->Branch("nvetomus"       , &nvetomus_       );
-
-    /////////////////////////// 
-    // End Event Information //
-    ///////////////////////////
-        
-        
-        
-    //////////////////////////// 
-    // Lepton Information     //
-    ////////////////////////////
-
-    babyTree_->Branch("lp4"    , "LorentzVector", &lp4_    ); 
-    babyTree_->Branch("mc3p4"  , "LorentzVector", &mc3p4_  ); 
-    babyTree_->Branch("foel_p4", "LorentzVector", &foel_p4_); 
-    babyTree_->Branch("fomu_p4", "LorentzVector", &fomu_p4_); 
-
-    babyTree_->Branch("foel_id"               , &foel_id_               ); 
-    babyTree_->Branch("fomu_id"               , &fomu_id_               ); 
-    babyTree_->Branch("foel_mass"             , &foel_mass_             ); 
-    babyTree_->Branch("fomu_mass"             , &fomu_mass_             ); 
-    babyTree_->Branch("pt"                    , &pt_                    ); 
-    babyTree_->Branch("eta"                   , &eta_                   ); 
-    babyTree_->Branch("sceta"                 , &sceta_                 ); 
-    babyTree_->Branch("phi"                   , &phi_                   ); 
-    babyTree_->Branch("scet"                  , &scet_                  ); 
-    babyTree_->Branch("d0"                    , &d0_                    ); 
-    babyTree_->Branch("dz"                    , &dz_                    ); 
-    babyTree_->Branch("ip3d"                  , &ip3d_                  ); 
-    babyTree_->Branch("d0err"                 , &d0err_                 ); 
-    babyTree_->Branch("dzerr"                 , &dzerr_                 ); 
-    babyTree_->Branch("ip3derr"               , &ip3derr_               ); 
-    babyTree_->Branch("hoe"                   , &hoe_                   ); 
-    babyTree_->Branch("pfmet"                 , &pfmet_                 ); 
-    babyTree_->Branch("pfmetphi"              , &pfmetphi_              ); 
-    babyTree_->Branch("iso"                   , &iso_                   ); 
-    babyTree_->Branch("iso_nps"               , &iso_nps_               ); 
-    babyTree_->Branch("trck_iso"              , &trck_iso_              ); 
-    babyTree_->Branch("ecal_iso"              , &ecal_iso_              ); 
-    babyTree_->Branch("ecal_iso_nps"          , &ecal_iso_nps_          ); 
-    babyTree_->Branch("hcal_iso"              , &hcal_iso_              ); 
-    babyTree_->Branch("pfiso03"               , &pfiso03_               ); 
-    babyTree_->Branch("ch_pfiso03"            , &ch_pfiso03_            ); 
-    babyTree_->Branch("nh_pfiso03"            , &nh_pfiso03_            ); 
-    babyTree_->Branch("em_pfiso03"            , &em_pfiso03_            ); 
-    //babyTree_->Branch("pfiso03_bv"            , &pfiso03_bv_            ); 
-    //babyTree_->Branch("ch_pfiso03_bv"         , &ch_pfiso03_bv_         ); 
-    //babyTree_->Branch("nh_pfiso03_bv"         , &nh_pfiso03_bv_         ); 
-    //babyTree_->Branch("em_pfiso03_bv"         , &em_pfiso03_bv_         ); 
-    babyTree_->Branch("pfiso04"               , &pfiso04_               ); 
-    babyTree_->Branch("ch_pfiso04"            , &ch_pfiso04_            ); 
-    babyTree_->Branch("nh_pfiso04"            , &nh_pfiso04_            ); 
-    babyTree_->Branch("em_pfiso04"            , &em_pfiso04_            ); 
-    //babyTree_->Branch("pfiso04_bv"            , &pfiso04_bv_            ); 
-    //babyTree_->Branch("ch_pfiso04_bv"         , &ch_pfiso04_bv_         ); 
-    //babyTree_->Branch("nh_pfiso04_bv"         , &nh_pfiso04_bv_         ); 
-    //babyTree_->Branch("em_pfiso04_bv"         , &em_pfiso04_bv_         ); 
-    //babyTree_->Branch("radiso_et1p0"          , &radiso_et1p0_          ); 
-    //babyTree_->Branch("ch_radiso_et1p0"       , &ch_radiso_et1p0_       ); 
-    //babyTree_->Branch("nh_radiso_et1p0"       , &nh_radiso_et1p0_       ); 
-    //babyTree_->Branch("em_radiso_et1p0"       , &em_radiso_et1p0_       ); 
-    //babyTree_->Branch("radiso_et0p5"          , &radiso_et0p5_          ); 
-    //babyTree_->Branch("ch_radiso_et0p5"       , &ch_radiso_et0p5_       ); 
-    //babyTree_->Branch("nh_radiso_et0p5"       , &nh_radiso_et0p5_       ); 
-    //babyTree_->Branch("em_radiso_et0p5"       , &em_radiso_et0p5_       ); 
-    //babyTree_->Branch("radiso_et1p0_bv"       , &radiso_et1p0_bv_       ); 
-    //babyTree_->Branch("ch_radiso_et1p0_bv"    , &ch_radiso_et1p0_bv_    ); 
-    //babyTree_->Branch("nh_radiso_et1p0_bv"    , &nh_radiso_et1p0_bv_    ); 
-    //babyTree_->Branch("em_radiso_et1p0_bv"    , &em_radiso_et1p0_bv_    ); 
-    //babyTree_->Branch("radiso_et0p5_bv"       , &radiso_et0p5_bv_       ); 
-    //babyTree_->Branch("ch_radiso_et0p5_bv"    , &ch_radiso_et0p5_bv_    ); 
-    //babyTree_->Branch("nh_radiso_et0p5_bv"    , &nh_radiso_et0p5_bv_    ); 
-    //babyTree_->Branch("em_radiso_et0p5_bv"    , &em_radiso_et0p5_bv_    ); 
-    babyTree_->Branch("pfpupt03"              , &pfpupt03_              ); 
-    babyTree_->Branch("pfpupt04"              , &pfpupt04_              ); 
-    babyTree_->Branch("cpfiso03_rho"          , &cpfiso03_rho_          ); 
-    babyTree_->Branch("cpfiso04_rho"          , &cpfiso04_rho_          ); 
-    babyTree_->Branch("cpfiso03_db"           , &cpfiso03_db_           ); 
-    babyTree_->Branch("id"                    , &id_                    ); 
-    babyTree_->Branch("closestMuon"           , &closestMuon_           ); 
-    babyTree_->Branch("el_id_sieie"           , &el_id_sieie_           );
-    babyTree_->Branch("el_id_detain"          , &el_id_detain_          );
-    babyTree_->Branch("el_id_dphiin"          , &el_id_dphiin_          );
-    babyTree_->Branch("el_id_smurfV5"         , &el_id_smurfV5_         ); 
-    babyTree_->Branch("el_id_vbtf80"          , &el_id_vbtf80_          ); 
-    babyTree_->Branch("el_id_vbtf90"          , &el_id_vbtf90_          ); 
-    babyTree_->Branch("el_effarea03"          , &el_effarea03_          ); 
-    babyTree_->Branch("el_effarea04"          , &el_effarea04_          ); 
-    babyTree_->Branch("mu_effarea03"          , &mu_effarea03_          ); 
-    babyTree_->Branch("mu_nh_effarea03"       , &mu_nh_effarea03_       ); 
-    babyTree_->Branch("mu_em_effarea03"       , &mu_em_effarea03_       ); 
-    babyTree_->Branch("mu_effarea03_tight"    , &mu_effarea03_tight_    ); 
-    babyTree_->Branch("mu_nh_effarea03_tight" , &mu_nh_effarea03_tight_ ); 
-    babyTree_->Branch("mu_em_effarea03_tight" , &mu_em_effarea03_tight_ ); 
-    babyTree_->Branch("mu_effarea04"          , &mu_effarea04_          ); 
-    babyTree_->Branch("mu_nh_effarea04"       , &mu_nh_effarea04_       ); 
-    babyTree_->Branch("mu_em_effarea04"       , &mu_em_effarea04_       ); 
-    babyTree_->Branch("mu_effarea04_tight"    , &mu_effarea04_tight_    ); 
-    babyTree_->Branch("mu_nh_effarea04_tight" , &mu_nh_effarea04_tight_ ); 
-    babyTree_->Branch("mu_em_effarea04_tight" , &mu_em_effarea04_tight_ ); 
-    babyTree_->Branch("conv0MissHits"         , &conv0MissHits_         ); 
-    babyTree_->Branch("convHitPattern"        , &convHitPattern_        ); 
-    babyTree_->Branch("convPartnerTrack"      , &convPartnerTrack_      ); 
-    babyTree_->Branch("convMIT"               , &convMIT_               ); 
-    babyTree_->Branch("mt"                    , &mt_                    ); 
-    babyTree_->Branch("pfmt"                  , &pfmt_                  ); 
-    babyTree_->Branch("q3"                    , &q3_                    ); 
-    babyTree_->Branch("els_exp_innerlayers"   , &els_exp_innerlayers_   ); 
-    babyTree_->Branch("d0PV_wwV1"             , &d0PV_wwV1_             ); 
-    babyTree_->Branch("dzPV_wwV1"             , &dzPV_wwV1_             ); 
-#ifndef __CMS2_SLIM__
-    babyTree_->Branch("ht_calo"               , &ht_calo_               ); 
-    babyTree_->Branch("ht_calo_L2L3"          , &ht_calo_L2L3_          ); 
-#endif
-    babyTree_->Branch("ht_pf"                 , &ht_pf_                 ); 
-    babyTree_->Branch("ht_pf_L2L3"            , &ht_pf_L2L3_            ); 
-    babyTree_->Branch("ht_pf_L1FastL2L3"      , &ht_pf_L1FastL2L3_      ); 
-    babyTree_->Branch("mcid"                  , &mcid_                  ); 
-    babyTree_->Branch("mcmotherid"            , &mcmotherid_            ); 
-    babyTree_->Branch("mc3id"                 , &mc3id_                 ); 
-    babyTree_->Branch("mc3pt"                 , &mc3pt_                 ); 
-    babyTree_->Branch("mc3dr"                 , &mc3dr_                 ); 
-    babyTree_->Branch("leptonIsFromW"         , &leptonIsFromW_         ); 
-    babyTree_->Branch("mu_isCosmic"           , &mu_isCosmic_           ); 
-    babyTree_->Branch("mu_ecal_veto_dep"      , &mu_ecal_veto_dep_      );
-    babyTree_->Branch("mu_hcal_veto_dep"      , &mu_hcal_veto_dep_      );
-    babyTree_->Branch("mu_nchi2"              , &mu_nchi2_              );
-
-    // Z mass variables
-    babyTree_->Branch("mz_fo_gsf"      , &mz_fo_gsf_      );
-    babyTree_->Branch("mz_gsf_iso"     , &mz_gsf_iso_     );
-    babyTree_->Branch("mz_fo_ctf"      , &mz_fo_ctf_      );
-    babyTree_->Branch("mz_ctf_iso"     , &mz_ctf_iso_     );
-    babyTree_->Branch("mupsilon_fo_mu" , &mupsilon_fo_mu_ );
-    babyTree_->Branch("mupsilon_mu_iso", &mupsilon_mu_iso_);
-
-    //////////////////////////// 
-    // End Lepton Information //
-    ////////////////////////////
-
-    //////////////////////////////////////////////////////
-    // Fake Rate Numerator & Denominator Selections     //
-    //////////////////////////////////////////////////////
-
-    //////////
-    // 2012 //
-    //////////
-
-    // SS
-    // Electrons
-    babyTree_->Branch("num_el_ssV7"       , &num_el_ssV7_       );
-    babyTree_->Branch("num_el_ssV7_noIso" , &num_el_ssV7_noIso_ );
-    babyTree_->Branch("v1_el_ssV7"        , &v1_el_ssV7_        );
-    babyTree_->Branch("v2_el_ssV7"        , &v2_el_ssV7_        );
-    babyTree_->Branch("v3_el_ssV7"        , &v3_el_ssV7_        );
-    
-    // Muons
-    babyTree_->Branch("num_mu_ssV5"       , &num_mu_ssV5_       );
-    babyTree_->Branch("num_mu_ssV5_noIso" , &num_mu_ssV5_noIso_ );
-    babyTree_->Branch("fo_mu_ssV5"        , &fo_mu_ssV5_        );
-    babyTree_->Branch("fo_mu_ssV5_noIso"  , &fo_mu_ssV5_noIso_  );
-
-    // TTZ
-    // Electrons
-    babyTree_->Branch("num_el_TTZcuttightv1",       &num_el_TTZcuttightv1_);
-    babyTree_->Branch("num_el_TTZcuttightv1_noIso", &num_el_TTZcuttightv1_noIso_);
-    babyTree_->Branch("fo_el_TTZcuttightv1",        &fo_el_TTZcuttightv1_);
-    babyTree_->Branch("fo_el_TTZcuttightv1_noIso",  &fo_el_TTZcuttightv1_noIso_);
-
-    babyTree_->Branch("num_el_TTZcutloosev1",       &num_el_TTZcutloosev1_);
-    babyTree_->Branch("num_el_TTZcutloosev1_noIso", &num_el_TTZcutloosev1_noIso_);
-    babyTree_->Branch("fo_el_TTZcutloosev1",        &fo_el_TTZcutloosev1_);
-    babyTree_->Branch("fo_el_TTZcutloosev1_noIso",  &fo_el_TTZcutloosev1_noIso_);
-
-    babyTree_->Branch("num_el_TTZMVAtightv1",       &num_el_TTZMVAtightv1_);
-    babyTree_->Branch("num_el_TTZMVAtightv1_noIso", &num_el_TTZMVAtightv1_noIso_);
-    babyTree_->Branch("fo_el_TTZMVAtightv1",        &fo_el_TTZMVAtightv1_);
-    babyTree_->Branch("fo_el_TTZMVAtightv1_noIso",  &fo_el_TTZMVAtightv1_noIso_);
-
-    babyTree_->Branch("num_el_TTZMVAloosev1",       &num_el_TTZMVAloosev1_);
-    babyTree_->Branch("num_el_TTZMVAloosev1_noIso", &num_el_TTZMVAloosev1_noIso_);
-    babyTree_->Branch("fo_el_TTZMVAloosev1",        &fo_el_TTZMVAloosev1_);
-    babyTree_->Branch("fo_el_TTZMVAloosev1_noIso",  &fo_el_TTZMVAloosev1_noIso_);
-
-    // Muons
-    babyTree_->Branch("num_mu_TTZtightv1",       &num_mu_TTZtightv1_);
-    babyTree_->Branch("num_mu_TTZtightv1_noIso", &num_mu_TTZtightv1_noIso_);
-    babyTree_->Branch("fo_mu_TTZtightv1",        &fo_mu_TTZtightv1_);
-    babyTree_->Branch("fo_mu_TTZtightv1_noIso",  &fo_mu_TTZtightv1_noIso_);
-
-    babyTree_->Branch("num_mu_TTZloosev1",       &num_mu_TTZloosev1_);
-    babyTree_->Branch("num_mu_TTZloosev1_noIso", &num_mu_TTZloosev1_noIso_);
-    babyTree_->Branch("fo_mu_TTZloosev1",        &fo_mu_TTZloosev1_);
-    babyTree_->Branch("fo_mu_TTZloosev1_noIso",  &fo_mu_TTZloosev1_noIso_);
-
-
-
-    //////////
-    // 2011 //
-    //////////
-
-    // SS
-
-    // Electrons
-    babyTree_->Branch("num_el_ssV6"       , &num_el_ssV6_       );
-    babyTree_->Branch("num_el_ssV6_noIso" , &num_el_ssV6_noIso_ );
-    babyTree_->Branch("v1_el_ssV6"        , &v1_el_ssV6_        );
-    babyTree_->Branch("v2_el_ssV6"        , &v2_el_ssV6_        );
-    babyTree_->Branch("v3_el_ssV6"        , &v3_el_ssV6_        );
-
-    // Muons
-    babyTree_->Branch("numNomSSv4"      , &numNomSSv4_      );
-    babyTree_->Branch("numNomSSv4noIso" , &numNomSSv4noIso_ );
-    babyTree_->Branch("fo_mussV4_04"    , &fo_mussV4_04_    );
-    babyTree_->Branch("fo_mussV4_noIso" , &fo_mussV4_noIso_ );
-
-    // WW, HWW
-
-    // Electrons
-    babyTree_->Branch("num_el_smurfV6"   , &num_el_smurfV6_   );
-    babyTree_->Branch("num_el_smurfV6lh" , &num_el_smurfV6lh_ );
-    babyTree_->Branch("v1_el_smurfV1"    , &v1_el_smurfV1_    );
-    babyTree_->Branch("v2_el_smurfV1"    , &v2_el_smurfV1_    );
-    babyTree_->Branch("v3_el_smurfV1"    , &v3_el_smurfV1_    );
-    babyTree_->Branch("v4_el_smurfV1"    , &v4_el_smurfV1_    );
-
-    // Muons
-    babyTree_->Branch("num_mu_smurfV6",  &num_mu_smurfV6_ );
-    babyTree_->Branch("fo_mu_smurf_04",  &fo_mu_smurf_04_ );
-    babyTree_->Branch("fo_mu_smurf_10",  &fo_mu_smurf_10_ );
-  
-    // OS
-    babyTree_->Branch("num_el_OSV2"  , &num_el_OSV2_  );
-    babyTree_->Branch("num_mu_OSGV2" , &num_mu_OSGV2_ );
-    babyTree_->Branch("num_mu_OSZV2" , &num_mu_OSZV2_ );
-    babyTree_->Branch("fo_el_OSV2"   , &fo_el_OSV2_   );
-    babyTree_->Branch("fo_mu_OSGV2"  , &fo_mu_OSGV2_  );
-
-    babyTree_->Branch("num_el_OSV3"  , &num_el_OSV3_  );
-    babyTree_->Branch("num_mu_OSGV3" , &num_mu_OSGV3_ );
-    babyTree_->Branch("fo_el_OSV3"   , &fo_el_OSV3_   );
-    babyTree_->Branch("fo_mu_OSGV3"  , &fo_mu_OSGV3_  );
-
-
-    //////////////////////////////////////////////////////
-    // End Fake Rate Numerator & Denominator Selections //
-    //////////////////////////////////////////////////////
-
-    ///////////////////////  
-    // Triggers          //
-    ///////////////////////
-
-    // Electrons
-    babyTree_->Branch("ele8_vstar"                                                        , &ele8_vstar_                                                        );
-    babyTree_->Branch("ele8_CaloIdL_TrkIdVL_vstar"                                        , &ele8_CaloIdL_TrkIdVL_vstar_                                        );
-    babyTree_->Branch("ele8_CaloIdL_CaloIsoVL_Jet40_vstar"                                , &ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                                );
-    babyTree_->Branch("ele8_CaloIdL_CaloIsoVL_vstar"                                      , &ele8_CaloIdL_CaloIsoVL_vstar_                                      );
-    babyTree_->Branch("ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar"                     , &ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_                     );
-    babyTree_->Branch("ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar"                     , &ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                     );
-    babyTree_->Branch("ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar"               , &ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_               );
-    babyTree_->Branch("ele8_CaloIdT_TrkIdVL_vstar"                                        , &ele8_CaloIdT_TrkIdVL_vstar_                                        );
-    babyTree_->Branch("ele8_CaloIdT_TrkIdVL_Jet30_vstar"                                  , &ele8_CaloIdT_TrkIdVL_Jet30_vstar_                                  );
-    babyTree_->Branch("ele17_CaloIdL_CaloIsoVL_vstar"                                     , &ele17_CaloIdL_CaloIsoVL_vstar_                                     );
-    babyTree_->Branch("ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar"                    , &ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                    );
-    babyTree_->Branch("ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar"              , &ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_              );
-    babyTree_->Branch("photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar"               , &photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_               );
-    babyTree_->Branch("ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar"       , &ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_       );
-    babyTree_->Branch("ele27_WP80_vstar"                                                  , &ele27_WP80_vstar_                                                  );
-
-    babyTree_->Branch("ele8_version"                                                      , &ele8_version_                                                      );
-    babyTree_->Branch("ele8_CaloIdL_TrkIdVL_version"                                      , &ele8_CaloIdL_TrkIdVL_version_                                      );
-    babyTree_->Branch("ele8_CaloIdL_CaloIsoVL_Jet40_version"                              , &ele8_CaloIdL_CaloIsoVL_Jet40_version_                              );
-    babyTree_->Branch("ele8_CaloIdL_CaloIsoVL_version"                                    , &ele8_CaloIdL_CaloIsoVL_version_                                    );
-    babyTree_->Branch("ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_version"                   , &ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_version_                   );
-    babyTree_->Branch("ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version"                   , &ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_                   );
-    babyTree_->Branch("ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version"             , &ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_             );
-    babyTree_->Branch("ele8_CaloIdT_TrkIdVL_version"                                      , &ele8_CaloIdT_TrkIdVL_version_                                      );
-    babyTree_->Branch("ele8_CaloIdT_TrkIdVL_Jet30_version"                                , &ele8_CaloIdT_TrkIdVL_Jet30_version_                                );
-    babyTree_->Branch("ele17_CaloIdL_CaloIsoVL_version"                                   , &ele17_CaloIdL_CaloIsoVL_version_                                   );
-    babyTree_->Branch("ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version"                  , &ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_                  );
-    babyTree_->Branch("ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version"            , &ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_            );
-    babyTree_->Branch("photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_version"             , &photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_version_             );
-    babyTree_->Branch("ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_version"     , &ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_version_     );
-    babyTree_->Branch("ele27_WP80_version"                                                , &ele27_WP80_version_                                                );
-
-    babyTree_->Branch("dr_ele8_vstar"                                                     , &dr_ele8_vstar_                                                     );
-    babyTree_->Branch("dr_ele8_CaloIdL_TrkIdVL_vstar"                                     , &dr_ele8_CaloIdL_TrkIdVL_vstar_                                     );
-    babyTree_->Branch("dr_ele8_CaloIdL_CaloIsoVL_Jet40_vstar"                             , &dr_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                             );
-    babyTree_->Branch("dr_ele8_CaloIdL_CaloIsoVL_vstar"                                   , &dr_ele8_CaloIdL_CaloIsoVL_vstar_                                   );
-    babyTree_->Branch("dr_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar"                  , &dr_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_                  );
-    babyTree_->Branch("dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar"                  , &dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                  );
-    babyTree_->Branch("dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar"            , &dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_            );
-    babyTree_->Branch("dr_ele8_CaloIdT_TrkIdVL_vstar"                                     , &dr_ele8_CaloIdT_TrkIdVL_vstar_                                     );
-    babyTree_->Branch("dr_ele8_CaloIdT_TrkIdVL_Jet30_vstar"                               , &dr_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                               );
-    babyTree_->Branch("dr_ele17_CaloIdL_CaloIsoVL_vstar"                                  , &dr_ele17_CaloIdL_CaloIsoVL_vstar_                                  );
-    babyTree_->Branch("dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar"                 , &dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                 );
-    babyTree_->Branch("dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar"           , &dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_           );
-    babyTree_->Branch("dr_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar"            , &dr_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_            );
-    babyTree_->Branch("dr_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar"    , &dr_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_    );
-    babyTree_->Branch("dr_ele27_WP80_vstar"                                               , &dr_ele27_WP80_vstar_                                               );
-
-    babyTree_->Branch("hltps_ele8_vstar"                                                  , &hltps_ele8_vstar_                                                  );
-    babyTree_->Branch("hltps_ele8_CaloIdL_TrkIdVL_vstar"                                  , &hltps_ele8_CaloIdL_TrkIdVL_vstar_                                  );
-    babyTree_->Branch("hltps_ele8_CaloIdL_CaloIsoVL_Jet40_vstar"                          , &hltps_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                          );
-    babyTree_->Branch("hltps_ele8_CaloIdL_CaloIsoVL_vstar"                                , &hltps_ele8_CaloIdL_CaloIsoVL_vstar_                                );
-    babyTree_->Branch("hltps_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar"               , &hltps_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_               );
-    babyTree_->Branch("hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar"               , &hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_               );
-    babyTree_->Branch("hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar"         , &hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_         );
-    babyTree_->Branch("hltps_ele8_CaloIdT_TrkIdVL_vstar"                                  , &hltps_ele8_CaloIdT_TrkIdVL_vstar_                                  );
-    babyTree_->Branch("hltps_ele8_CaloIdT_TrkIdVL_Jet30_vstar"                            , &hltps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                            );
-    babyTree_->Branch("hltps_ele17_CaloIdL_CaloIsoVL_vstar"                               , &hltps_ele17_CaloIdL_CaloIsoVL_vstar_                               );
-    babyTree_->Branch("hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar"              , &hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_              );
-    babyTree_->Branch("hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar"        , &hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_        );
-    babyTree_->Branch("hltps_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar"         , &hltps_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_         );
-    babyTree_->Branch("hltps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar" , &hltps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_ );
-    babyTree_->Branch("hltps_ele27_WP80_vstar"                                            , &hltps_ele27_WP80_vstar_                                            );
+    cout << "[FR baby maker]: branch sizes of " << babyTree_->GetEntries() << " entries (compression settings " << babyTree_->GetCurrentFile()->GetCompressionSettings() << ")" << endl;
+    cout << Form("  %-60s %12s %12s %7s", "branch", "uncompressed", "compressed", "ratio") << endl;
+    Long64_t totBytes = 0;
+    Long64_t zipBytes = 0;
+    for (unsigned int ibranch = 0; ibranch < sizes.size(); ibranch++)
+    {
+        const BranchSize& size = sizes[ibranch];
+        cout << Form("  %-60s %12lld %12lld %7.2f", size.name.c_str(), size.totBytes, size.zipBytes, size.zipBytes > 0 ? static_cast<double>(size.totBytes) / size.zipBytes : 0.) << endl;
+        totBytes += size.totBytes;
+        zipBytes += size.zipBytes;
+    }
+    cout << Form("  %-60s %12lld %12lld %7.2f", "total", totBytes, zipBytes, zipBytes > 0 ? static_cast<double>(totBytes) / zipBytes : 0.) << endl;
+
+    // Reduced precision floats: the largest errors (also of the rows merged
+    // from the workers or kept by a resume), and the mantissa bytes
+    // zeroed, the most the compression can save on the branch compared to
+    // full precision (the actual saving is in the table above when compared
+    // with a full precision baby).
+    if (quantizedBranches_.empty())
+        return;
+    cout << "[FR baby maker]: reduced precision floats" << endl;
+    cout << Form("  %-60s %12s %12s %12s %12s %12s", "branch", "precision", "max abs err", "max rel err", "compressed", "bytes zeroed") << endl;
+    const Long64_t entries = babyTree_->GetEntries();
+    for (unsigned int ibranch = 0; ibranch < quantizedBranches_.size(); ibranch++)
+    {
+        const QuantizedBranch& branch = quantizedBranches_[ibranch];
+        TBranch* treeBranch = babyTree_->GetBranch(branch.name.c_str());
+        const TString precision = (branch.quantum > 0) ? Form("step %g", branch.quantum) : Form("%d bits", branch.mantissaBits);
+        const TString zeroed = (branch.quantum > 0) ? TString("-") : Form("%lld", entries * (branch.p4 ? 4 : 1) * (23 - branch.mantissaBits) / 8);
+        cout << Form("  %-60s %12s %12.3g %12.3g %12lld %12s", branch.name.c_str(), precision.Data(), branch.maxAbsError, branch.maxRelError,
+                     treeBranch ? treeBranch->GetZipBytes("*") : 0LL, zeroed.Data()) << endl;
+    }
+}
 
-#ifndef __CMS2_SLIM__
-    babyTree_->Branch("l1ps_ele8_CaloIdL_CaloIsoVL_vstar"                                 , &l1ps_ele8_CaloIdL_CaloIsoVL_vstar_                                 );
-    babyTree_->Branch("l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar"                , &l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                );
-    babyTree_->Branch("l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar"          , &l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_          );
-    babyTree_->Branch("l1ps_ele8_CaloIdT_TrkIdVL_vstar"                                   , &l1ps_ele8_CaloIdT_TrkIdVL_vstar_                                   );
-    babyTree_->Branch("l1ps_ele8_CaloIdT_TrkIdVL_Jet30_vstar"                             , &l1ps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                             );
-    babyTree_->Branch("l1ps_ele17_CaloIdL_CaloIsoVL_vstar"                                , &l1ps_ele17_CaloIdL_CaloIsoVL_vstar_                                );
-    babyTree_->Branch("l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar"               , &l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_               );
-    babyTree_->Branch("l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar"         , &l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_         );
-    babyTree_->Branch("l1ps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar"  , &l1ps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_  );
-    babyTree_->Branch("l1ps_ele27_WP80_vstar"                                             , &l1ps_ele27_WP80_vstar_                                             );
-#endif
+// Roll the baby over to a new part (name_1.root, name_2.root, ...) when the
+// current part reached the size or entry limit of SetMaxOutputSize.
+// Call this between events, so that the rows of an event stay in one part.
+// The size is the end of the file on disk, so the baskets still in memory
+// are not counted and the parts come out somewhat larger than the limit.
+void myBabyMaker::CheckOutputRollover()
+{
+    if (maxOutputBytes_ <= 0 && maxOutputEntries_ <= 0)
+        return;
 
-    // Muons
-    babyTree_->Branch("mu3_vstar"                  , &mu3_vstar_                  ); 
-    babyTree_->Branch("mu5_vstar"                  , &mu5_vstar_                  ); 
-    babyTree_->Branch("mu8_vstar"                  , &mu8_vstar_                  ); 
-    babyTree_->Branch("mu12_vstar"                 , &mu12_vstar_                 ); 
-    babyTree_->Branch("mu15_vstar"                 , &mu15_vstar_                 ); 
-    babyTree_->Branch("mu17_vstar"                 , &mu17_vstar_                 ); 
-    babyTree_->Branch("mu20_vstar"                 , &mu20_vstar_                 ); 
-    babyTree_->Branch("mu24_vstar"                 , &mu24_vstar_                 ); 
-    babyTree_->Branch("mu30_vstar"                 , &mu30_vstar_                 ); 
-    babyTree_->Branch("mu15_eta2p1_vstar"          , &mu15_eta2p1_vstar_          ); 
-    babyTree_->Branch("mu24_eta2p1_vstar"          , &mu24_eta2p1_vstar_          ); 
-    babyTree_->Branch("mu30_eta2p1_vstar"          , &mu30_eta2p1_vstar_          ); 
-    babyTree_->Branch("mu8_Jet40_vstar"            , &mu8_Jet40_vstar_            ); 
-    babyTree_->Branch("isoMu20_eta2p1_vstar"       , &isoMu20_eta2p1_vstar_       ); 
-    babyTree_->Branch("isoMu24_eta2p1_vstar"       , &isoMu24_eta2p1_vstar_       ); 
-    babyTree_->Branch("isoMu30_eta2p1_vstar"       , &isoMu30_eta2p1_vstar_       ); 
-    babyTree_->Branch("relIso1p0Mu17_vstar"        , &relIso1p0Mu17_vstar_        ); 
-    babyTree_->Branch("relIso1p0Mu20_vstar"        , &relIso1p0Mu20_vstar_        ); 
-    babyTree_->Branch("relIso1p0Mu5_vstar"         , &relIso1p0Mu5_vstar_         ); 
-
-    babyTree_->Branch("mu3_version"                , &mu3_version_                ); 
-    babyTree_->Branch("mu5_version"                , &mu5_version_                ); 
-    babyTree_->Branch("mu8_version"                , &mu8_version_                ); 
-    babyTree_->Branch("mu12_version"               , &mu12_version_               ); 
-    babyTree_->Branch("mu15_version"               , &mu15_version_               ); 
-    babyTree_->Branch("mu17_version"               , &mu17_version_               ); 
-    babyTree_->Branch("mu20_version"               , &mu20_version_               ); 
-    babyTree_->Branch("mu24_version"               , &mu24_version_               ); 
-    babyTree_->Branch("mu30_version"               , &mu30_version_               ); 
-    babyTree_->Branch("mu15_eta2p1_version"        , &mu15_eta2p1_version_        ); 
-    babyTree_->Branch("mu24_eta2p1_version"        , &mu24_eta2p1_version_        ); 
-    babyTree_->Branch("mu30_eta2p1_version"        , &mu30_eta2p1_version_        ); 
-    babyTree_->Branch("mu8_Jet40_version"          , &mu8_Jet40_version_          ); 
-    babyTree_->Branch("isoMu20_eta2p1_version"     , &isoMu20_eta2p1_version_     ); 
-    babyTree_->Branch("isoMu24_eta2p1_version"     , &isoMu24_eta2p1_version_     ); 
-    babyTree_->Branch("isoMu30_eta2p1_version"     , &isoMu30_eta2p1_version_     ); 
-    babyTree_->Branch("relIso1p0Mu17_version"      , &relIso1p0Mu17_version_      ); 
-    babyTree_->Branch("relIso1p0Mu20_version"      , &relIso1p0Mu20_version_      ); 
-    babyTree_->Branch("relIso1p0Mu5_version"       , &relIso1p0Mu5_version_       ); 
-
-    babyTree_->Branch("dr_mu3_vstar"               , &dr_mu3_vstar_               ); 
-    babyTree_->Branch("dr_mu5_vstar"               , &dr_mu5_vstar_               ); 
-    babyTree_->Branch("dr_mu8_vstar"               , &dr_mu8_vstar_               ); 
-    babyTree_->Branch("dr_mu12_vstar"              , &dr_mu12_vstar_              ); 
-    babyTree_->Branch("dr_mu15_vstar"              , &dr_mu15_vstar_              ); 
-    babyTree_->Branch("dr_mu17_vstar"              , &dr_mu17_vstar_              ); 
-    babyTree_->Branch("dr_mu20_vstar"              , &dr_mu20_vstar_              ); 
-    babyTree_->Branch("dr_mu24_vstar"              , &dr_mu24_vstar_              ); 
-    babyTree_->Branch("dr_mu30_vstar"              , &dr_mu30_vstar_              ); 
-    babyTree_->Branch("dr_mu15_eta2p1_vstar"       , &dr_mu15_eta2p1_vstar_       ); 
-    babyTree_->Branch("dr_mu24_eta2p1_vstar"       , &dr_mu24_eta2p1_vstar_       ); 
-    babyTree_->Branch("dr_mu30_eta2p1_vstar"       , &dr_mu30_eta2p1_vstar_       ); 
-    babyTree_->Branch("dr_mu8_Jet40_vstar"         , &dr_mu8_Jet40_vstar_         ); 
-    babyTree_->Branch("dr_isoMu20_eta2p1_vstar"    , &dr_isoMu20_eta2p1_vstar_    ); 
-    babyTree_->Branch("dr_isoMu24_eta2p1_vstar"    , &dr_isoMu24_eta2p1_vstar_    ); 
-    babyTree_->Branch("dr_isoMu30_eta2p1_vstar"    , &dr_isoMu30_eta2p1_vstar_    ); 
-    babyTree_->Branch("dr_relIso1p0Mu17_vstar"     , &dr_relIso1p0Mu17_vstar_     ); 
-    babyTree_->Branch("dr_relIso1p0Mu20_vstar"     , &dr_relIso1p0Mu20_vstar_     ); 
-    babyTree_->Branch("dr_relIso1p0Mu5_vstar"      , &dr_relIso1p0Mu5_vstar_      ); 
-
-    babyTree_->Branch("hltps_mu3_vstar"            , &hltps_mu3_vstar_            ); 
-    babyTree_->Branch("hltps_mu5_vstar"            , &hltps_mu5_vstar_            ); 
-    babyTree_->Branch("hltps_mu8_vstar"            , &hltps_mu8_vstar_            ); 
-    babyTree_->Branch("hltps_mu12_vstar"           , &hltps_mu12_vstar_           ); 
-    babyTree_->Branch("hltps_mu15_vstar"           , &hltps_mu15_vstar_           ); 
-    babyTree_->Branch("hltps_mu17_vstar"           , &hltps_mu17_vstar_           ); 
-    babyTree_->Branch("hltps_mu20_vstar"           , &hltps_mu20_vstar_           ); 
-    babyTree_->Branch("hltps_mu24_vstar"           , &hltps_mu24_vstar_           ); 
-    babyTree_->Branch("hltps_mu30_vstar"           , &hltps_mu30_vstar_           ); 
-    babyTree_->Branch("hltps_mu15_eta2p1_vstar"    , &hltps_mu15_eta2p1_vstar_    ); 
-    babyTree_->Branch("hltps_mu24_eta2p1_vstar"    , &hltps_mu24_eta2p1_vstar_    ); 
-    babyTree_->Branch("hltps_mu30_eta2p1_vstar"    , &hltps_mu30_eta2p1_vstar_    ); 
-    babyTree_->Branch("hltps_mu8_Jet40_vstar"      , &hltps_mu8_Jet40_vstar_      ); 
-    babyTree_->Branch("hltps_isoMu20_eta2p1_vstar" , &hltps_isoMu20_eta2p1_vstar_ ); 
-    babyTree_->Branch("hltps_isoMu24_eta2p1_vstar" , &hltps_isoMu24_eta2p1_vstar_ ); 
-    babyTree_->Branch("hltps_isoMu30_eta2p1_vstar" , &hltps_isoMu30_eta2p1_vstar_ ); 
-    babyTree_->Branch("hltps_relIso1p0Mu17_vstar"  , &hltps_relIso1p0Mu17_vstar_  ); 
-    babyTree_->Branch("hltps_relIso1p0Mu20_vstar"  , &hltps_relIso1p0Mu20_vstar_  ); 
-    babyTree_->Branch("hltps_relIso1p0Mu5_vstar"   , &hltps_relIso1p0Mu5_vstar_   ); 
+    const Long64_t entries = babyTree_->GetEntries() - partFirstEntry_;
+    if (entries == 0)
+        return;
 
-#ifndef __CMS2_SLIM__
-    babyTree_->Branch("l1ps_mu5_vstar"             , &l1ps_mu5_vstar_             ); 
-    babyTree_->Branch("l1ps_mu8_vstar"             , &l1ps_mu8_vstar_             ); 
-    babyTree_->Branch("l1ps_mu12_vstar"            , &l1ps_mu12_vstar_            ); 
-    babyTree_->Branch("l1ps_mu17_vstar"            , &l1ps_mu17_vstar_            ); 
-    babyTree_->Branch("l1ps_mu15_eta2p1_vstar"     , &l1ps_mu15_eta2p1_vstar_     ); 
-    babyTree_->Branch("l1ps_mu24_eta2p1_vstar"     , &l1ps_mu24_eta2p1_vstar_     ); 
-    babyTree_->Branch("l1ps_mu30_eta2p1_vstar"     , &l1ps_mu30_eta2p1_vstar_     ); 
-    babyTree_->Branch("l1ps_isoMu20_eta2p1_vstar"  , &l1ps_isoMu20_eta2p1_vstar_  ); 
-    babyTree_->Branch("l1ps_isoMu24_eta2p1_vstar"  , &l1ps_isoMu24_eta2p1_vstar_  ); 
-    babyTree_->Branch("l1ps_isoMu30_eta2p1_vstar"  , &l1ps_isoMu30_eta2p1_vstar_  ); 
-    babyTree_->Branch("l1ps_relIso1p0Mu17_vstar"   , &l1ps_relIso1p0Mu17_vstar_   ); 
-    babyTree_->Branch("l1ps_relIso1p0Mu5_vstar"    , &l1ps_relIso1p0Mu5_vstar_    ); 
-#endif
+    TFile* file = babyTree_->GetCurrentFile();
+    const bool tooBig  = (maxOutputBytes_   > 0 && file->GetEND() >= maxOutputBytes_);
+    const bool tooLong = (maxOutputEntries_ > 0 && entries >= maxOutputEntries_);
+    if (!tooBig && !tooLong)
+        return;
 
-    ///////////////////////  
-    // End 2011 Triggers //
-    ///////////////////////
-        
-    //////////////
-    // Jets     //
-    //////////////
+    outputParts_.push_back(file->GetName());
+    outputPartEntries_.push_back(entries);
 
-    // Information to do offline jet trigger selection
-#ifndef __CMS2_SLIM__
-    babyTree_->Branch("ptj1"         , &ptj1_         );
-    babyTree_->Branch("nj1"          , &nj1_          );
-    babyTree_->Branch("ptj1_b2b"     , &ptj1_b2b_     );
-    babyTree_->Branch("dphij1_b2b"   , &dphij1_b2b_   );
-#endif
-    babyTree_->Branch("ptpfj1"       , &ptpfj1_       );
-    babyTree_->Branch("npfj1"        , &npfj1_        );
-    babyTree_->Branch("ptpfj1_b2b"   , &ptpfj1_b2b_   );
-    babyTree_->Branch("dphipfj1_b2b" , &dphipfj1_b2b_ );
-      
-    // PF L2L3 Corrected jets
-    babyTree_->Branch("ptpfcj1"      , &ptpfcj1_      );
-    babyTree_->Branch("npfcj1"       , &npfcj1_       );
-    babyTree_->Branch("ptpfcj1_b2b"  , &ptpfcj1_b2b_  );
-    babyTree_->Branch("dphipfcj1_b2b", &dphipfcj1_b2b_);
-    babyTree_->Branch("btagpfc"      , &btagpfc_      );
-      
-    // PF L1FastL2L3 Corrected jets         
-    babyTree_->Branch("emfpfcL1Fj1"     , &emfpfcL1Fj1_      );
-    babyTree_->Branch("ptpfcL1Fj1"      , &ptpfcL1Fj1_       );       
-    babyTree_->Branch("dphipfcL1Fj1"    , &dphipfcL1Fj1_     );       
-    babyTree_->Branch("npfcL1Fj1"       , &npfcL1Fj1_        );
-    babyTree_->Branch("npfc30L1Fj1"     , &npfc30L1Fj1_      );
-    babyTree_->Branch("npfc40L1Fj1"     , &npfc40L1Fj1_      );
-    babyTree_->Branch("nbpfc40L1Fj1"    , &nbpfc40L1Fj1_     );
-    babyTree_->Branch("ptpfcL1Fj1_b2b"  , &ptpfcL1Fj1_b2b_   );       
-    babyTree_->Branch("dphipfcL1Fj1_b2b", &dphipfcL1Fj1_b2b_ );     
-    babyTree_->Branch("btagpfcL1F"      , &btagpfcL1F_       );
-    babyTree_->Branch("npfc50L1Fj1_eth" , &npfc50L1Fj1_eth_  );
-    babyTree_->Branch("npfc65L1Fj1_eth" , &npfc65L1Fj1_eth_  );
-
-    // PF L1FastL2L3Residual Corrected jets         
-    babyTree_->Branch("emfpfcL1Fj1res"     , &emfpfcL1Fj1res_      );
-    babyTree_->Branch("ptpfcL1Fj1res"      , &ptpfcL1Fj1res_       );       
-    babyTree_->Branch("dphipfcL1Fj1res"    , &dphipfcL1Fj1res_     );       
-    babyTree_->Branch("npfcL1Fj1res"       , &npfcL1Fj1res_        );
-    babyTree_->Branch("npfc30L1Fj1res"     , &npfc30L1Fj1res_      );
-    babyTree_->Branch("npfc40L1Fj1res"     , &npfc40L1Fj1res_      );
-    babyTree_->Branch("nbpfc40L1Fj1res"    , &nbpfc40L1Fj1res_     );
-    babyTree_->Branch("ptpfcL1Fj1res_b2b"  , &ptpfcL1Fj1res_b2b_   );       
-    babyTree_->Branch("dphipfcL1Fj1res_b2b", &dphipfcL1Fj1res_b2b_ );     
-    babyTree_->Branch("btagpfcL1Fres"      , &btagpfcL1Fres_       );
-    babyTree_->Branch("npfc50L1Fj1res_eth" , &npfc50L1Fj1res_eth_  );
-    babyTree_->Branch("npfc65L1Fj1res_eth" , &npfc65L1Fj1res_eth_  );
-
-    // B-tagged PF L1FastL2L3 Corrected jets         
-    babyTree_->Branch("ptbtagpfcL1Fj1"   , &ptbtagpfcL1Fj1_   );
-    babyTree_->Branch("dphibtagpfcL1Fj1" , &dphibtagpfcL1Fj1_ );
-    
-    // B-tagged PF L1FastL2L3Residual Corrected jets         
-    babyTree_->Branch("ptbtagpfcL1Fj1res"   , &ptbtagpfcL1Fj1res_   );
-    babyTree_->Branch("dphibtagpfcL1Fj1res" , &dphibtagpfcL1Fj1res_ );
-    
-#ifndef __CMS2_SLIM__
-    // B Tagging
-    babyTree_->Branch("nbjet"        , &nbjet_        );
-    babyTree_->Branch("dRNear"       , &dRbNear_      );
-    babyTree_->Branch("dRFar"        , &dRbFar_       );
-#endif
-      
-    babyTree_->Branch("nbpfcjet"     , &nbpfcjet_     );
-    babyTree_->Branch("dRpfcNear"    , &dRbpfcNear_   );
-    babyTree_->Branch("dRpfcFar"     , &dRbpfcFar_    );
+    // every part has the names of all the rows so far
+    WriteBabyMetadata();
 
-    babyTree_->Branch("rho", &rho_);
-    
-    //////////////
-    // End Jets //
-    //////////////
+    // writes the tree to the old file and continues in name_N.root
+    babyFile_ = babyTree_->ChangeFile(file);
+    partFirstEntry_ = babyTree_->GetEntries();
+    if (verbose_)
+    {
+        cout << "[FR baby maker]: " << outputParts_.back() << " closed with " << entries << " entries, continuing in " << babyFile_->GetName() << endl;
+    }
 }
 
-// Fill the baby
-void myBabyMaker::FillBabyNtuple()
-{ 
-    babyTree_->Fill(); 
+// name tables of dataset_idx and filename_idx in the current output file
+void myBabyMaker::WriteBabyMetadata()
+{
+    TFile* file = babyTree_->GetCurrentFile();
+    baby_metadata::WriteNames(file, baby_metadata::kDatasets , datasetNames_);
+    baby_metadata::WriteNames(file, baby_metadata::kFilenames, fileNames_   );
+    if (!selectionBits2012_.empty())
+        baby_metadata::WriteNames(file, "selections2012_bits", selectionBits2012_);
+    if (!selectionBits2011_.empty())
+        baby_metadata::WriteNames(file, "selections2011_bits", selectionBits2011_);
+    if (!triggerNames_.empty())
+        baby_metadata::WriteNames(file, baby_metadata::kTriggers, triggerNames_);
+    if (!quantizedBranches_.empty())
+    {
+        std::vector<std::string> errors;
+        for (unsigned int ibranch = 0; ibranch < quantizedBranches_.size(); ibranch++)
+        {
+            const QuantizedBranch& branch = quantizedBranches_[ibranch];
+            errors.push_back(Form("%s %.17g %.17g", branch.name.c_str(), branch.maxAbsError, branch.maxRelError));
+        }
+        baby_metadata::WriteNames(file, baby_metadata::kQuantizationErrors, errors);
+    }
 }
 
-// Close the baby
-void myBabyMaker::CloseBabyNtuple()
+// <name>.manifest: one line per part with the file name and its number of entries
+void myBabyMaker::WriteOutputManifest() const
 {
-    babyFile_->cd();
-    babyTree_->Write();
-    babyFile_->Close();
+    TString manifestName = outputParts_.front();
+    if (manifestName.EndsWith(".root"))
+        manifestName.Remove(manifestName.Length() - 5);
+    manifestName += ".manifest";
+
+    std::ofstream manifest(manifestName.Data());
+    manifest << "# part entries" << endl;
+    Long64_t total = 0;
+    for (unsigned int ipart = 0; ipart < outputParts_.size(); ipart++)
+    {
+        manifest << outputParts_.at(ipart) << " " << outputPartEntries_.at(ipart) << endl;
+        total += outputPartEntries_.at(ipart);
+    }
+    cout << "[FR baby maker]: " << outputParts_.size() << " output parts with " << total << " entries listed in " << manifestName << endl;
 }
 
 // constructor
@@ -1682,415 +2051,40 @@ myBabyMaker::myBabyMaker ()
     , babyTree_                                                          ( NULL   )
     , nEvents_                                                           ( -1     )
     , verbose_                                                           ( false  )
+    , nWorkers_                                                          ( 1      )
+    , triggerStudy_                                                      ( false  )
+    , branchGroups_                                                      ( kBabyAll )
+    , duplicateSpillFile_                                                ( ""     )
+    , duplicateMaxMemoryMB_                                              ( 0      )
+    , journal_                                                           ( false  )
+    , maxOutputBytes_                                                    ( 0      )
+    , maxOutputEntries_                                                  ( 0      )
+    , partFirstEntry_                                                    ( 0      )
+    , compressionSettings_                                               ( -1     )
+    , basketSizes_                                                       ( kNumBranchGroups, 32000 )
+    , autoFlush_                                                         ( 0      )
+    , compressionReport_                                                 ( false  )
+    , splitEvents_                                                       ( false  )
+    , floatMantissaBits_                                                 ( kNumBranchGroups, 23 )
+    , floatQuanta_                                                       ( kNumBranchGroups, 0  )
+    , writeBaby_                                                         ( true   )
+    , packSelections_                                                    ( false  )
+    , selections2012_                                                    ( 0      )
+    , selections2011_                                                    ( 0      )
+    , compactTriggers_                                                   ( false  )
+    , ntrigs_                                                            ( 0      )
+    , ledgerTree_                                                        ( NULL   )
+    , writeLedger_                                                       ( false  )
+    , ledger_run_                                                        ( -1     )
+    , ledger_ls_                                                         ( -1     )
+    , ledger_evt_                                                        ( 0      )
+    , ledger_is_real_data_                                               ( false  )
+    , ledger_first_row_                                                  ( 0      )
     , goodrun_is_json                                                    ( false  )
-    , run_                                                               ( -1     )
-    , ls_                                                                ( -1     )
-    , evt_                                                               ( 0      )
-    , weight_                                                            ( 1.0    )
-    , dataset_                                                           ( ""     )
-    , filename_                                                          ( ""     )
-    , is_real_data_                                                      ( false  )
-    , pu_nPUvertices_                                                    ( -1     )
-    , pu_nPUtrueint_                                                     ( -1.0   )
-    , evt_nvtxs_                                                         ( -1     )
-    , nFOels_                                                            ( 0      )
-    , nFOmus_                                                            ( 0      )
-    , ngsfs_                                                             ( 0      )
-    , nmus_                                                              ( 0      )
-    , nvetoels_                                                          ( 0      )
-    , nvetomus_                                                          ( 0      )
-    , pt_                                                                ( -999.  )
-    , eta_                                                               ( -999.  )
-    , sceta_                                                             ( -999.  )
-    , phi_                                                               ( -999.  )
-    , scet_                                                              ( -999.  )
-    , id_                                                                ( -1     )
-    , hoe_                                                               ( -999.  )
-    , d0_                                                                ( -999.  )
-    , d0err_                                                             ( -999.  )
-    , dz_                                                                ( -999.  )
-    , dzerr_                                                             ( -999.  )
-    , ip3d_                                                              ( -999.  )
-    , ip3derr_                                                           ( -999.  )
-    , lp4_                                                               ( 0,0,0,0)
-    , foel_p4_                                                           ( 0,0,0,0)
-    , foel_id_                                                           ( -999   )
-    , fomu_p4_                                                           ( 0,0,0,0)
-    , fomu_id_                                                           ( -999   )
-    , foel_mass_                                                         ( -999.0 )
-    , fomu_mass_                                                         ( -999.0 )
-    , pfmet_                                                             ( -999.  )
-    , pfmetphi_                                                          ( -999.  )
-    , iso_                                                               ( -999.  )
-    , iso_nps_                                                           ( -999.  )
-    , trck_iso_                                                          ( -999.  )
-    , ecal_iso_                                                          ( -999.  )
-    , ecal_iso_nps_                                                      ( -999.  )
-    , hcal_iso_                                                          ( -999.  )
-    , pfiso03_                                                           ( -999.  )
-    , ch_pfiso03_                                                        ( -999.  )
-    , nh_pfiso03_                                                        ( -999.  )
-    , em_pfiso03_                                                        ( -999.  )
-    , pfiso03_bv_                                                        ( -999.  )
-    , ch_pfiso03_bv_                                                     ( -999.  )
-    , nh_pfiso03_bv_                                                     ( -999.  )
-    , em_pfiso03_bv_                                                     ( -999.  )
-    , pfiso04_                                                           ( -999.  )
-    , ch_pfiso04_                                                        ( -999.  )
-    , nh_pfiso04_                                                        ( -999.  )
-    , em_pfiso04_                                                        ( -999.  )
-    , pfiso04_bv_                                                        ( -999.  )
-    , ch_pfiso04_bv_                                                     ( -999.  )
-    , nh_pfiso04_bv_                                                     ( -999.  )
-    , em_pfiso04_bv_                                                     ( -999.  )
-    , radiso_et1p0_                                                      ( -999.  )
-    , ch_radiso_et1p0_                                                   ( -999.  )
-    , nh_radiso_et1p0_                                                   ( -999.  )
-    , em_radiso_et1p0_                                                   ( -999.  )
-    , radiso_et1p0_bv_                                                   ( -999.  )
-    , ch_radiso_et1p0_bv_                                                ( -999.  )
-    , nh_radiso_et1p0_bv_                                                ( -999.  )
-    , em_radiso_et1p0_bv_                                                ( -999.  )
-    , radiso_et0p5_                                                      ( -999.  )
-    , ch_radiso_et0p5_                                                   ( -999.  )
-    , nh_radiso_et0p5_                                                   ( -999.  )
-    , em_radiso_et0p5_                                                   ( -999.  )
-    , radiso_et0p5_bv_                                                   ( -999.  )
-    , ch_radiso_et0p5_bv_                                                ( -999.  )
-    , nh_radiso_et0p5_bv_                                                ( -999.  )
-    , em_radiso_et0p5_bv_                                                ( -999.  )
-    , pfpupt03_                                                          ( -999.  )
-    , pfpupt04_                                                          ( -999.  )
-    , cpfiso03_rho_                                                      ( -999.  )
-    , cpfiso04_rho_                                                      ( -999.  )
-    , cpfiso03_db_                                                       ( -999.  )
-    , d0PV_wwV1_                                                         ( -999.  )
-    , dzPV_wwV1_                                                         ( -999.  )
-    , closestMuon_                                                       ( false  )
-    , el_id_sieie_                                                       ( -999.  )
-    , el_id_detain_                                                      ( -999.  )
-    , el_id_dphiin_                                                      ( -999.  )
-    , el_id_smurfV5_                                                     ( false  )
-    , el_id_vbtf80_                                                      ( false  )
-    , el_id_vbtf90_                                                      ( false  )
-    , el_effarea03_                                                      ( -999.  )
-    , el_effarea04_                                                      ( -999.  )
-    , mu_effarea03_                                                      ( -999.  )
-    , mu_nh_effarea03_                                                   ( -999.  )
-    , mu_em_effarea03_                                                   ( -999.  )
-    , mu_effarea03_tight_                                                ( -999.  )
-    , mu_nh_effarea03_tight_                                             ( -999.  )
-    , mu_em_effarea03_tight_                                             ( -999.  )
-    , mu_effarea04_                                                      ( -999.  )
-    , mu_nh_effarea04_                                                   ( -999.  )
-    , mu_em_effarea04_                                                   ( -999.  )
-    , mu_effarea04_tight_                                                ( -999.  )
-    , mu_nh_effarea04_tight_                                             ( -999.  )
-    , mu_em_effarea04_tight_                                             ( -999.  )
-    , mz_fo_gsf_                                                         ( -999.  )
-    , mz_gsf_iso_                                                        ( -999.  )
-    , mz_fo_ctf_                                                         ( -999.  )
-    , mz_ctf_iso_                                                        ( -999.  )
-    , mupsilon_fo_mu_                                                    ( -999.  )
-    , mupsilon_mu_iso_                                                   ( -999.  )
-    , mu_isCosmic_                                                       ( false  )
-    , mu_ecal_veto_dep_                                                  ( -999.  )
-    , mu_hcal_veto_dep_                                                  ( -999.  )
-    , mu_nchi2_                                                          ( -999.  )
-    , convHitPattern_                                                    ( false  )
-    , convPartnerTrack_                                                  ( false  )
-    , convMIT_                                                           ( false  )
-    , conv0MissHits_                                                     ( false  )
-#ifndef __CMS2_SLIM__
-    , ht_calo_                                                           ( -999   )
-    , ht_calo_L2L3_                                                      ( -999   )
-#endif
-    , ht_pf_                                                             ( -999   )
-    , ht_pf_L2L3_                                                        ( -999   )
-    , ht_pf_L1FastL2L3_                                                  ( -999   )
-    , mcid_                                                              ( 0      )
-    , mcmotherid_                                                        ( 0      )
-    , mc3id_                                                             ( -999   )
-    , mc3pt_                                                             ( -999.  )
-    , mc3dr_                                                             ( -999.  )
-    , mc3p4_                                                             ( 0,0,0,0)
-    , leptonIsFromW_                                                     ( -999   )
-    , num_el_ssV7_                                                       ( false  )
-    , num_el_ssV7_noIso_                                                 ( false  )
-    , v1_el_ssV7_                                                        ( false  )
-    , v2_el_ssV7_                                                        ( false  )
-    , v3_el_ssV7_                                                        ( false  )
-    , num_mu_ssV5_                                                       ( false  )
-    , num_mu_ssV5_noIso_                                                 ( false  )
-    , fo_mu_ssV5_                                                        ( false  )
-    , fo_mu_ssV5_noIso_                                                  ( false  )
-    , num_el_TTZcuttightv1_                                              ( false  )
-    , num_el_TTZcuttightv1_noIso_                                        ( false  )
-    , fo_el_TTZcuttightv1_                                               ( false  )
-    , fo_el_TTZcuttightv1_noIso_                                         ( false  )
-    , num_el_TTZcutloosev1_                                              ( false  )
-    , num_el_TTZcutloosev1_noIso_                                        ( false  )
-    , fo_el_TTZcutloosev1_                                               ( false  )
-    , fo_el_TTZcutloosev1_noIso_                                         ( false  )
-    , num_el_TTZMVAtightv1_                                              ( false  )
-    , num_el_TTZMVAtightv1_noIso_                                        ( false  )
-    , fo_el_TTZMVAtightv1_                                               ( false  )
-    , fo_el_TTZMVAtightv1_noIso_                                         ( false  )
-    , num_el_TTZMVAloosev1_                                              ( false  )
-    , num_el_TTZMVAloosev1_noIso_                                        ( false  )
-    , fo_el_TTZMVAloosev1_                                               ( false  )
-    , fo_el_TTZMVAloosev1_noIso_                                         ( false  )
-    , num_mu_TTZtightv1_                                                 ( false  )
-    , num_mu_TTZtightv1_noIso_                                           ( false  )
-    , fo_mu_TTZtightv1_                                                  ( false  )
-    , fo_mu_TTZtightv1_noIso_                                            ( false  )
-    , num_mu_TTZloosev1_                                                 ( false  )
-    , num_mu_TTZloosev1_noIso_                                           ( false  )
-    , fo_mu_TTZloosev1_                                                  ( false  )
-    , fo_mu_TTZloosev1_noIso_                                            ( false  )
-    , num_el_ssV6_                                                       ( false  )
-    , v1_el_ssV6_                                                        ( false  )
-    , v2_el_ssV6_                                                        ( false  )
-    , v3_el_ssV6_                                                        ( false  )
-    , num_el_ssV6_noIso_                                                 ( false  )
-    , numNomSSv4_                                                        ( false  )
-    , fo_mussV4_04_                                                      ( false  )
-    , numNomSSv4noIso_                                                   ( false  )
-    , fo_mussV4_noIso_                                                   ( false  )
-    , num_el_smurfV6_                                                    ( false  )
-    , num_el_smurfV6lh_                                                  ( false  )
-    , v1_el_smurfV1_                                                     ( false  )
-    , v2_el_smurfV1_                                                     ( false  )
-    , v3_el_smurfV1_                                                     ( false  )
-    , v4_el_smurfV1_                                                     ( false  )
-    , num_mu_smurfV6_                                                    ( false  )
-    , fo_mu_smurf_04_                                                    ( false  )
-    , fo_mu_smurf_10_                                                    ( false  )
-    , num_el_OSV2_                                                       ( false  )
-    , num_mu_OSGV2_                                                      ( false  )
-    , num_mu_OSZV2_                                                      ( false  )
-    , fo_el_OSV2_                                                        ( false  )
-    , fo_mu_OSGV2_                                                       ( false  )
-    , num_el_OSV3_                                                       ( false  )
-    , num_mu_OSGV3_                                                      ( false  )
-    , fo_el_OSV3_                                                        ( false  )
-    , fo_mu_OSGV3_                                                       ( false  )
-    , ele8_CaloIdL_CaloIsoVL_vstar_                                      ( 0      )
-    , ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                     ( 0      )
-    , ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_               ( 0      )
-    , ele8_CaloIdT_TrkIdVL_vstar_                                        ( 0      )
-    , ele8_CaloIdT_TrkIdVL_Jet30_vstar_                                  ( 0      )
-    , ele17_CaloIdL_CaloIsoVL_vstar_                                     ( 0      )
-    , ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                    ( 0      )
-    , ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_              ( 0      )
-    , ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_       ( 0      )
-    , ele27_WP80_vstar_                                                  ( 0      )
-    , ele8_CaloIdL_CaloIsoVL_version_                                    ( - 1    )
-    , ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_                   ( - 1    )
-    , ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_             ( - 1    )
-    , ele8_CaloIdT_TrkIdVL_version_                                      ( - 1    )
-    , ele8_CaloIdT_TrkIdVL_Jet30_version_                                ( - 1    )
-    , ele17_CaloIdL_CaloIsoVL_version_                                   ( - 1    )
-    , ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_                  ( - 1    )
-    , ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_            ( - 1    )
-    , ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_version_     ( - 1    )
-    , ele27_WP80_version_                                                ( - 1    )
-    , dr_ele8_CaloIdL_CaloIsoVL_vstar_                                   ( 99.0   )
-    , dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                  ( 99.0   )
-    , dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_            ( 99.0   )
-    , dr_ele8_CaloIdT_TrkIdVL_vstar_                                     ( 99.0   )
-    , dr_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                               ( 99.0   )
-    , dr_ele17_CaloIdL_CaloIsoVL_vstar_                                  ( 99.0   )
-    , dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                 ( 99.0   )
-    , dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_           ( 99.0   )
-    , dr_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_    ( 99.0   )
-    , dr_ele27_WP80_vstar_                                               ( 99.0   )
-    , hltps_ele8_CaloIdL_CaloIsoVL_vstar_                                ( - 1    )
-    , hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_               ( - 1    )
-    , hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_         ( - 1    )
-    , hltps_ele8_CaloIdT_TrkIdVL_vstar_                                  ( - 1    )
-    , hltps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                            ( - 1    )
-    , hltps_ele17_CaloIdL_CaloIsoVL_vstar_                               ( - 1    )
-    , hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_              ( - 1    )
-    , hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_        ( - 1    )
-    , hltps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_ ( - 1    )
-    , hltps_ele27_WP80_vstar_                                            ( - 1    )
-    #ifndef __CMS2_SLIM__
-    , l1ps_ele17_CaloIdL_CaloIsoVL_vstar_                                ( - 1    )
-    , l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_               ( - 1    )
-    , l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_         ( - 1    )
-    , l1ps_ele8_CaloIdL_CaloIsoVL_vstar_                                 ( - 1    )
-    , l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                ( - 1    )
-    , l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_          ( - 1    )
-    , l1ps_ele8_CaloIdT_TrkIdVL_vstar_                                   ( - 1    )
-    , l1ps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                             ( - 1    )
-    , l1ps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_  ( - 1    )
-    , l1ps_ele27_WP80_vstar_                                             ( - 1    )
-    #endif
-    , mu5_vstar_                                                         ( 0      )
-    , mu8_vstar_                                                         ( 0      )
-    , mu12_vstar_                                                        ( 0      )
-    , mu17_vstar_                                                        ( 0      )
-    , mu15_eta2p1_vstar_                                                 ( 0      )
-    , mu24_eta2p1_vstar_                                                 ( 0      )
-    , mu30_eta2p1_vstar_                                                 ( 0      )
-    , isoMu20_eta2p1_vstar_                                              ( 0      )
-    , isoMu24_eta2p1_vstar_                                              ( 0      )
-    , isoMu30_eta2p1_vstar_                                              ( 0      )
-    , relIso1p0Mu17_vstar_                                               ( 0      )
-    , relIso1p0Mu20_vstar_                                               ( 0      )
-    , relIso1p0Mu5_vstar_                                                ( 0      )
-    , mu5_version_                                                       ( -1     )
-    , mu8_version_                                                       ( -1     )
-    , mu12_version_                                                      ( -1     )
-    , mu17_version_                                                      ( -1     )
-    , mu15_eta2p1_version_                                               ( -1     )
-    , mu24_eta2p1_version_                                               ( -1     )
-    , mu30_eta2p1_version_                                               ( -1     )
-    , isoMu20_eta2p1_version_                                            ( -1     )
-    , isoMu24_eta2p1_version_                                            ( -1     )
-    , isoMu30_eta2p1_version_                                            ( -1     )
-    , relIso1p0Mu17_version_                                             ( -1     )
-    , relIso1p0Mu20_version_                                             ( -1     )
-    , relIso1p0Mu5_version_                                              ( -1     )
-    , dr_mu5_vstar_                                                      ( 99.0   )
-    , dr_mu8_vstar_                                                      ( 99.0   )
-    , dr_mu12_vstar_                                                     ( 99.0   )
-    , dr_mu17_vstar_                                                     ( 99.0   )
-    , dr_mu15_eta2p1_vstar_                                              ( 99.0   )
-    , dr_mu24_eta2p1_vstar_                                              ( 99.0   )
-    , dr_mu30_eta2p1_vstar_                                              ( 99.0   )
-    , dr_isoMu20_eta2p1_vstar_                                           ( 99.0   )
-    , dr_isoMu24_eta2p1_vstar_                                           ( 99.0   )
-    , dr_isoMu30_eta2p1_vstar_                                           ( 99.0   )
-    , dr_relIso1p0Mu17_vstar_                                            ( 99.0   )
-    , dr_relIso1p0Mu20_vstar_                                            ( 99.0   )
-    , dr_relIso1p0Mu5_vstar_                                             ( 99.0   )
-    , hltps_mu5_vstar_                                                   ( -1     )
-    , hltps_mu8_vstar_                                                   ( -1     )
-    , hltps_mu12_vstar_                                                  ( -1     )
-    , hltps_mu17_vstar_                                                  ( -1     )
-    , hltps_mu15_eta2p1_vstar_                                           ( -1     )
-    , hltps_mu24_eta2p1_vstar_                                           ( -1     )
-    , hltps_mu30_eta2p1_vstar_                                           ( -1     )
-    , hltps_isoMu20_eta2p1_vstar_                                        ( -1     )
-    , hltps_isoMu24_eta2p1_vstar_                                        ( -1     )
-    , hltps_isoMu30_eta2p1_vstar_                                        ( -1     )
-    , hltps_relIso1p0Mu17_vstar_                                         ( -1     )
-    , hltps_relIso1p0Mu20_vstar_                                         ( -1     )
-    , hltps_relIso1p0Mu5_vstar_                                          ( -1     )
-    #ifndef __CMS2_SLIM__
-    , l1ps_mu5_vstar_                                                    ( -1     )
-    , l1ps_mu8_vstar_                                                    ( -1     )
-    , l1ps_mu12_vstar_                                                   ( -1     )
-    , l1ps_mu17_vstar_                                                   ( -1     )
-    , l1ps_mu15_eta2p1_vstar_                                            ( -1     )
-    , l1ps_mu24_eta2p1_vstar_                                            ( -1     )
-    , l1ps_mu30_eta2p1_vstar_                                            ( -1     )
-    , l1ps_isoMu20_eta2p1_vstar_                                         ( -1     )
-    , l1ps_isoMu24_eta2p1_vstar_                                         ( -1     )
-    , l1ps_isoMu30_eta2p1_vstar_                                         ( -1     )
-    , l1ps_relIso1p0Mu17_vstar_                                          ( -1     )
-    , l1ps_relIso1p0Mu5_vstar_                                           ( -1     )
-    #endif
-    , ele8_vstar_                                                        ( 0      )
-    , ele8_CaloIdL_TrkIdVL_vstar_                                        ( 0      )
-    , ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                                ( 0      )
-    , ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_                     ( 0      )
-    , photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_               ( 0      )
-    , ele8_CaloIdL_TrkIdVL_version_                                      ( -1     )
-    , ele8_CaloIdL_CaloIsoVL_Jet40_version_                              ( -1     )
-    , ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_version_                   ( -1     )
-    , photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_version_             ( -1     )
-    , dr_ele8_CaloIdL_TrkIdVL_vstar_                                     ( 99.0   )
-    , dr_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                             ( 99.0   )
-    , dr_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_                  ( 99.0   )
-    , dr_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_            ( 99.0   )
-    , hltps_ele8_CaloIdL_TrkIdVL_vstar_                                  ( -1     )
-    , hltps_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                          ( -1     )
-    , hltps_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_               ( -1     )
-    , hltps_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_         ( -1     )
-    , mu3_vstar_                                                         ( 0      )
-    , mu15_vstar_                                                        ( 0      )
-    , mu20_vstar_                                                        ( 0      )
-    , mu24_vstar_                                                        ( 0      )
-    , mu30_vstar_                                                        ( 0      )
-    , mu8_Jet40_vstar_                                                   ( 0      )
-    , mu3_version_                                                       ( -1     )
-    , mu15_version_                                                      ( -1     )
-    , mu20_version_                                                      ( -1     )
-    , mu24_version_                                                      ( -1     )
-    , mu30_version_                                                      ( -1     )
-    , mu8_Jet40_version_                                                 ( -1     )
-    , dr_mu3_vstar_                                                      ( 99.0   )
-    , dr_mu15_vstar_                                                     ( 99.0   )
-    , dr_mu20_vstar_                                                     ( 99.0   )
-    , dr_mu24_vstar_                                                     ( 99.0   )
-    , dr_mu30_vstar_                                                     ( 99.0   )
-    , dr_mu8_Jet40_vstar_                                                ( 99.0   )
-    , hltps_mu3_vstar_                                                   ( -1     )
-    , hltps_mu15_vstar_                                                  ( -1     )
-    , hltps_mu20_vstar_                                                  ( -1     )
-    , hltps_mu24_vstar_                                                  ( -1     )
-    , hltps_mu30_vstar_                                                  ( -1     )
-    , hltps_mu8_Jet40_vstar_                                             ( -1     )
-    , nbpfcjet_                                                          ( 0      )
-    , dRbpfcNear_                                                        ( 99.    )
-    , dRbpfcFar_                                                         ( -99.   )
-#ifndef __CMS2_SLIM__
-    , ptj1_                                                              ( 0.     )
-    , ptj1_b2b_                                                          ( -999.  )
-    , dphij1_b2b_                                                        ( -999.  )
-    , nj1_                                                               ( 0      )
-#endif
-    , ptpfj1_                                                            ( 0.     )
-    , ptpfj1_b2b_                                                        ( -999.  )
-    , dphipfj1_b2b_                                                      ( -999.  )
-    , npfj1_                                                             ( 0      )
-    , ptpfcj1_                                                           ( 0.     )
-    , ptpfcj1_b2b_                                                       ( -999.  )
-    , dphipfcj1_b2b_                                                     ( -999.  )
-    , npfcj1_                                                            ( 0      )
-    , btagpfc_                                                           ( false  )
-    , emfpfcL1Fj1_                                                       ( -999.  )
-    , ptpfcL1Fj1_                                                        ( 0.     )
-    , dphipfcL1Fj1_                                                      ( -999.  )
-    , ptpfcL1Fj1_b2b_                                                    ( -999.  )
-    , dphipfcL1Fj1_b2b_                                                  ( -999.  )
-    , npfcL1Fj1_                                                         ( 0      )
-    , btagpfcL1F_                                                        ( false  )
-    , npfc30L1Fj1_                                                       ( 0      )
-    , npfc40L1Fj1_                                                       ( 0      )
-    , npfc50L1Fj1_eth_                                                   ( 0      )
-    , npfc65L1Fj1_eth_                                                   ( 0      )
-    , nbpfc40L1Fj1_                                                      ( 0      )
-
-    , ptbtagpfcL1Fj1_                                                    ( 0.     )
-    , dphibtagpfcL1Fj1_                                                  ( -999.  )
-    , emfpfcL1Fj1res_                                                    ( -999.  )
-    , ptpfcL1Fj1res_                                                     ( 0.     )
-    , dphipfcL1Fj1res_                                                   ( -999.  )
-    , ptpfcL1Fj1res_b2b_                                                 ( -999.  )
-    , dphipfcL1Fj1res_b2b_                                               ( -999.  )
-    , npfcL1Fj1res_                                                      ( 0      )
-    , btagpfcL1Fres_                                                     ( false  )
-    , npfc30L1Fj1res_                                                    ( 0      )
-    , npfc40L1Fj1res_                                                    ( 0      )
-    , npfc50L1Fj1res_eth_                                                ( 0      )
-    , npfc65L1Fj1res_eth_                                                ( 0      )
-    , nbpfc40L1Fj1res_                                                   ( 0      )
-    , ptbtagpfcL1Fj1res_                                                 ( 0.     )
-    , dphibtagpfcL1Fj1res_                                               ( -999.  )
-    , rho_                                                               ( -999.  )
-#ifndef __CMS2_SLIM__
-    , nbjet_                                                             ( 0      )
-    , dRbNear_                                                           ( 99.    )
-    , dRbFar_                                                            ( -99.   )
-#endif
-    , mt_                                                                ( -999   )
-    , pfmt_                                                              ( -999   )
-    , q3_                                                                ( false  )
-    , els_exp_innerlayers_                                               ( 999    )
+#define BABY_BRANCH(type, member, branch, value, group) , member ( value )
+#define BABY_VARIABLE(type, member, value, group) , member ( value )
+#define BABY_FLAG(member, branch, group) , member ( false )
+#include "myBabyBranches.h"
     , ele8_regexp                                                        ("HLT_Ele8_v(\\d+)"                                                 , "o")
     , ele8_CaloIdL_TrkIdVL_regexp                                        ("HLT_Ele8_CaloIdL_TrkIdVL_v(\\d+)"                                 , "o")
     , ele8_CaloIdL_CaloIsoVL_regexp                                      ("HLT_Ele8_CaloIdL_CaloIsoVL_v(\\d+)"                               , "o")
@@ -2136,14 +2130,56 @@ myBabyMaker::myBabyMaker ()
 //      =11 do electrons
 //      =13 do muons
 //-----------------------------------
-void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu, bool applyFOfilter, const std::string& jetcorrPath)
+bool myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu, bool applyFOfilter, const std::string& jetcorrPath)
 {
+    // split the files over several worker processes
+    if (nWorkers_ > 1)
+    {
+        return ScanChainParallel(chain, babyFilename, eormu, applyFOfilter, jetcorrPath);
+    }
+
     try
     {
-        already_seen.clear();
+        already_seen.Clear();
+        already_seen.SetSpillFile(duplicateSpillFile_, duplicateMaxMemoryMB_);
+
+        // trigger study dump (off unless requested)
+#ifdef __NO_TRIGGER_STUDY__
+        if (triggerStudy_)
+            cout << "[FR baby maker]: trigger study requested but compiled out (__NO_TRIGGER_STUDY__)" << endl;
+#endif
+        trigger_study.SetEnabled(triggerStudy_);
+
+        // the rows written so far are what a resumed job starts from
+        // (the settings below are for this run only, SetJournal and SetMaxOutputSize are kept)
+        bool journal = journal_;
+        if (journal && !writeBaby_)
+        {
+            cout << "[FR baby maker]: the journal needs the baby to resume from, turning it off" << endl;
+            journal = false;
+        }
 
         // Make a baby ntuple
-        MakeBabyNtuple(babyFilename);
+        // (with the journal on, an interrupted job first picks up the files it had completed)
+        unsigned int nCompletedFiles  = 0;
+        unsigned int nEventsJournaled = 0;
+        if (journal)
+            ResumeFromJournal(babyFilename, chain->GetListOfFiles(), nCompletedFiles, nEventsJournaled);
+        else
+            MakeBabyNtuple(babyFilename);
+
+        // the journal refers to a single output file
+        const bool rollOutput = !journal;
+        if (journal && (maxOutputBytes_ > 0 || maxOutputEntries_ > 0))
+            cout << "[FR baby maker]: rolling output files are not supported with the journal, writing a single file" << endl;
+
+        std::ofstream journalFile;
+        if (journal)
+        {
+            journalFile.open(Form("%s.journal", babyFilename), ios::app);
+            if (!journalFile)
+                throw std::runtime_error(Form("[FR baby maker]: could not open journal %s.journal", babyFilename));
+        }
 
         // Jet Corrections
         std::vector<std::string> jetcorr_pf_L2L3_filenames;
@@ -2188,6 +2224,9 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
         float deltaRCut   = 1.0;
         float deltaPhiCut = 2.5;
 
+        // PF jets of the current event (reused to keep the allocations)
+        PFJetCache jetCache;
+
         //--------------------------
         // File and Event Loop
         //---------------------------
@@ -2197,7 +2236,7 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
         bmark.Start("benchmark");
 
         int i_permilleOld = 0;
-        unsigned int nEventsTotal = 0;
+        unsigned int nEventsTotal = nEventsJournaled;
         unsigned int nEventsChain = 0;
         int nEvents = nEvents_; 
         if (nEvents==-1){
@@ -2213,6 +2252,7 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
         std::cout << "nEventTotal = " << nEventsTotal << endl;
         std::cout << "nEventChain = " << nEventsChain << endl;
 
+        unsigned int ifile = 0;
         while(TChainElement *currentFile = (TChainElement*)fileIter.Next())
         {
             if (finish_looping) {
@@ -2220,6 +2260,11 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
             }
 
             TString filename = currentFile->GetTitle();
+
+            // already in the baby (see ResumeFromJournal)
+            if (ifile++ < nCompletedFiles) {
+                continue;
+            }
             if (verbose_)
             {
                 cout << filename << endl;
@@ -2228,6 +2273,10 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
             TFile* f = TFile::Open(filename.Data());
             TTree* tree = (TTree*)f->Get("Events");
             cms2.Init(tree);
+            const Int_t fileIndex = NameIndex(fileNames_, f->GetName());
+
+            // new file: the trigger classes are resolved again for its menu
+            trigger_class_index.Clear();
 
             unsigned int nEntries = tree->GetEntries();
             unsigned int nGoodEvents(0);
@@ -2239,6 +2288,10 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
             { 
                 cms2.GetEntry(z);
 
+                // the previous event is complete: start a new output part if needed
+                if (rollOutput)
+                    CheckOutputRollover();
+
                 if (nEventsTotal >= nEventsChain) {
                     finish_looping = true;
                     break;
@@ -2248,7 +2301,10 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
 
                 if(isData){
                     // Good  Runs
-                    if (goodrun_is_json) {
+                    if (good_run_list.Loaded()) {
+                        if(!good_run_list.Contains(evt_run(), evt_lumiBlock())) continue;
+                    }
+                    else if (goodrun_is_json) {
                         if(!goodrun_json(evt_run(), evt_lumiBlock())) continue;   
                     }
                     else {
@@ -2266,6 +2322,17 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                 // looper progress
                 ++nEventsTotal;
                 ++nGoodEvents;
+
+                // record the event for the merge step of ScanChainParallel (or the journal)
+                if (ledgerTree_)
+                {
+                    ledger_run_          = evt_run();
+                    ledger_ls_           = evt_lumiBlock();
+                    ledger_evt_          = evt_event();
+                    ledger_is_real_data_ = isData;
+                    ledger_first_row_    = babyTree_->GetEntries();
+                    ledgerTree_->Fill();
+                }
                 int i_permille = (int)floor(1000 * nEventsTotal / float(nEventsChain));
                 if (i_permille != i_permilleOld) {
                     printf("  \015\033[32m ---> \033[1m\033[31m%4.1f%%" "\033[0m\033[32m <---\033[0m\015", i_permille/10.);
@@ -2280,6 +2347,10 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                 //if (!cleaning_goodTracks()) continue;
                 if (!cleaning_standardApril2011()) continue;
 
+                // event level quantities shared by all the leptons
+                EventContext eventContext;
+                eventContext.Fill(isData);
+
                 // Loop over jets and see what is btagged
                 // Medium operating point from https://twiki.cern.ch/twiki/bin/view/CMS/BTagPerformanceOP
 
@@ -2289,151 +2360,28 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                 //             for (unsigned int iJet = 0; iJet < jets_p4().size(); iJet++) {
                 //                 if (jets_p4().at(iJet).pt() < 15.) continue;
                 //                 if (cms2.jets_combinedSecondaryVertexBJetTag().at(iJet) < 0.679) continue;
-                //                 this_nbjet++;
-                //                 bindex.push_back(iJet);
-                //             }
-                // #endif
-
-                // PF Jets
-                int this_nbpfjet = 0;
-                //FactorizedJetCorrector* jet_pf_corrector = evt_isRealData() ? jet_pf_L1FastJetL2L3Residual_corrector : jet_pf_L1FastJetL2L3_corrector; 
-                vector<unsigned int> bpfindex;
-                for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                    if ( !passesPFJetID(iJet)) continue;
-                    LorentzVector jp4 = pfjets_p4().at(iJet);
-                    //jet_pf_corrector->setRho(cms2.evt_ww_rho_vor());
-                    //jet_pf_corrector->setJetA(cms2.pfjets_area().at(iJet));
-                    //jet_pf_corrector->setJetPt(cms2.pfjets_p4().at(iJet).pt());
-                    //jet_pf_corrector->setJetEta(cms2.pfjets_p4().at(iJet).eta()); 
-                    //float jet_cor = jetCorrection(jp4, jet_pf_corrector);
-                    float jet_cor = evt_isRealData() ? cms2.pfjets_corL1FastL2L3residual().at(iJet) : cms2.pfjets_corL1FastL2L3().at(iJet);
-                    LorentzVector jp4cor = jp4 * jet_cor;
-                    if (jp4cor.pt() < 15) continue;
-                    if (cms2.pfjets_combinedSecondaryVertexBJetTag().at(iJet) < 0.679) continue;
-                    this_nbpfjet++;
-                    bpfindex.push_back(iJet);
-                }
-
-                // Electrons
-                if (eormu == -1 || eormu==11) {
-                    for (unsigned int iLep = 0 ; iLep < els_p4().size(); iLep++) {
-
-                        // Apply a pt cut (Changed it from 5 GeV to 10 GeV...Claudio 10 July 2010)
-                        if ( els_p4().at(iLep).pt() < 10.) continue;
-
-                        // Initialize baby ntuple
-                        InitBabyNtuple();
-
-                        //////////////////////////////////////////////////////
-                        // Fake Rate Numerator & Denominator Selections     //
-                        //////////////////////////////////////////////////////
-
-                        // store number of electron FOs in event (use SS FO definition)
-                        nFOels_ = 0;
-                        ngsfs_ = 0;
-                        for (unsigned int iel = 0; iel < cms2.els_p4().size(); iel++)
-                        {
-                            if (iel == iLep)
-                                continue;
-
-                            if (cms2.els_p4().at(iel).pt() < 10.)
-                                continue;
-
-                            if (pass_electronSelection(iel, electronSelectionFOV7_v3, false, false))
-                                ++ngsfs_;
-
-                            if (samesign::isDenominatorLepton(11, iel)) {
-                                ++nFOels_;
-                                if (cms2.els_p4().at(iel).pt() > foel_p4_.pt() && iel != iLep) {
-                                    foel_p4_ = cms2.els_p4().at(iel);
-                                    foel_id_ = 11*cms2.els_charge().at(iel);
-                                }
-                                continue;
-                            }
-                            if (samesign::isDenominatorLepton(11, iel)) {
-                                ++nFOels_;
-                                if (cms2.els_p4().at(iel).pt() > foel_p4_.pt() && iel != iLep) {
-                                    foel_p4_ = cms2.els_p4().at(iel);
-                                    foel_id_ = 11*cms2.els_charge().at(iel);
-                                }
-                                continue;
-                            }
-                        }
-
-                        // store number of muon FOs in event (use SS FO definition)
-                        nFOmus_ = 0;
-                        nmus_ = 0;
-                        for (unsigned int imu = 0; imu < cms2.mus_p4().size(); imu++)
-                        {
-                            if (cms2.mus_p4().at(imu).pt() < 10.)
-                                continue;
-
-                            if (muonIdNotIsolated(imu, muonSelectionFO_ssV5))
-                                ++nmus_;
-
-                            if (samesign::isDenominatorLepton(13, imu)) {
-                                ++nFOmus_;
-                                if (cms2.mus_p4().at(imu).pt() > fomu_p4_.pt()) {
-                                    fomu_p4_ = cms2.mus_p4().at(imu);
-                                    fomu_id_ = 13*cms2.mus_charge().at(imu);
-                                }
-                                continue;
-                            }
-                            if (samesign::isDenominatorLepton(13, imu)) {
-                                ++nFOmus_;
-                                if (cms2.mus_p4().at(imu).pt() > fomu_p4_.pt()) {
-                                    fomu_p4_ = cms2.mus_p4().at(imu);
-                                    fomu_id_ = 13*cms2.mus_charge().at(imu);
-                                }
-                                continue;
-                            }
-                        }
-
-                        // store number of "veto" electrons in event
-                        nvetoels_ = 0;
-                        for (unsigned int iel = 0; iel < cms2.els_p4().size(); iel++)
-                        {
-                            if (iel == iLep) // skip the current electron
-                                continue;
-
-                            if (cms2.els_p4().at(iel).pt() < 5.0f)
-                                continue;
-
-                            if (fabs(cms2.els_p4().at(iel).eta()) > 2.4f)
-                                continue;
-
-                            const float iso = electronIsoValuePF2012_FastJetEffArea_v3(iel, /*conesize=*/0.3, /*vtx=*/-999, /*52X iso=*/false);
-                            if (iso > 1.0)
-                                continue;
-
-                            // if we get here, then count it
-                            nvetoels_++;
-                        }
+                //                 this_nbjet++;
+                //                 bindex.push_back(iJet);
+                //             }
+                // #endif
 
-                        // store number of "veto" muons in event
-                        nvetomus_ = 0;
-                        for (unsigned int imu = 0; imu < cms2.mus_p4().size(); imu++)
-                        {
-                            if (cms2.mus_p4().at(imu).pt() < 5.0f)
-                                continue;
+                // PF Jets (all correction levels, b-tagging)
+                if (BranchGroupSelected(kBabyJets))
+                    jetCache.Fill(jet_pf_L2L3corrector);
 
-                            if (fabs(cms2.mus_p4().at(imu).eta()) > 2.4f)
-                                continue;
+                // Electrons
+                if (eormu == -1 || eormu==11) {
+                    for (unsigned int iLep = 0 ; iLep < els_p4().size(); iLep++) {
 
-                            const bool is_global      = ((cms2.mus_type().at(imu) & (1<<1)) != 0);
-                            const bool is_tracker     = ((cms2.mus_type().at(imu) & (1<<2)) != 0);
-                            const bool is_pfmu        = ((cms2.mus_type().at(imu) & (1<<5)) != 0);
-                            const bool passes_mu_type = ((is_global or is_tracker) and is_pfmu);
-                            if (not passes_mu_type)
-                                continue;
+                        // Apply a pt cut (Changed it from 5 GeV to 10 GeV...Claudio 10 July 2010)
+                        if ( els_p4().at(iLep).pt() < 10.) continue;
 
-                            const float iso = muonIsoValuePF2012_deltaBeta(imu); 
-                            if (iso > 1.0)
-                                continue;
+                        // Initialize baby ntuple
+                        InitBabyNtuple();
 
-                            // if we get here, then count it
-                            nvetomus_++;
-                        }
+                        //////////////////////////////////////////////////////
+                        // Fake Rate Numerator & Denominator Selections     //
+                        //////////////////////////////////////////////////////
 
                         //////////
                         // 2012 //
@@ -2512,6 +2460,11 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         // End Fake Rate Numerator & Denominator Selections //
                         //////////////////////////////////////////////////////
 
+                        // number of additional objects in the event (the electron itself is not counted)
+                        if (!eventContext.hasLeptons)
+                            eventContext.FillLeptons();
+                        FillEventCounts(eventContext, /*eormu=*/11, iLep);
+
 
                         ////////////////////////////////////////////////////////////////////////
                         // NEED TO THINK ABOUT THIS... Z'S ARE VETOED BASED ON TOP SELECTIONS //
@@ -2583,42 +2536,9 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         // Event Information     //
                         ///////////////////////////
 
-                        // Load the electron and event quantities
-                        run_          = evt_run();
-                        ls_           = evt_lumiBlock();
-                        evt_          = evt_event();
-                        weight_       = isData ? 1.0 : evt_scale1fb();
-                        filename_     = f->GetName();
-                        dataset_      = evt_dataset().front();
-                        is_real_data_ = evt_isRealData();
-
-                        if(!isData){
-                            // Pileup - PUSummaryInfoMaker                        
-                            for (unsigned int vidx = 0; vidx < cms2.puInfo_nPUvertices().size(); vidx++) {
-                                if (cms2.puInfo_bunchCrossing().at(vidx) != 0)
-                                    continue;
-                                pu_nPUvertices_ = cms2.puInfo_nPUvertices().at(vidx);
-                                pu_nPUtrueint_  = cms2.puInfo_trueNumInteractions().at(vidx);
-                            }
-
-                        }
-
-                        // Pileup - VertexMaker
-                        bool first_good_vertex_found         = false;
-                        unsigned int first_good_vertex_index = 0;
-                        for (unsigned int vidx = 0; vidx < cms2.vtxs_position().size(); vidx++)
-                        {
-                            if (!isGoodVertex(vidx))
-                            {
-                                continue;
-                            }
-                            if (!first_good_vertex_found)
-                            {
-                                first_good_vertex_found = true;
-                                first_good_vertex_index = vidx;
-                            }
-                            ++evt_nvtxs_;
-                        }
+                        // Load the event quantities
+                        FillEventInformation(eventContext);
+                        filename_idx_ = fileIndex;
 
                         /////////////////////////// 
                         // End Event Information //
@@ -2662,8 +2582,6 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         ip3derr_   = els_ip3derr().at(iLep);;
 
 
-                        pfmet_     = evt_pfmet();
-                        pfmetphi_  = evt_pfmetPhi();
                         foel_mass_ = sqrt(fabs((lp4_ + foel_p4_).mass2()));
                         fomu_mass_ = sqrt(fabs((lp4_ + fomu_p4_).mass2()));
 
@@ -2746,13 +2664,16 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         if( els_exp_innerlayers().at(iLep) == 0 ) conv0MissHits_ = true;
 
                         // HT
+                        if (BranchGroupSelected(kBabyJets))
+                        {
 #ifndef __CMS2_SLIM__
-                        ht_calo_           = (float) sumPt (iLep, JETS_TYPE_CALO_UNCORR  , JETS_CLEAN_SINGLE_E );
-                        ht_calo_L2L3_      = (float) sumPt (iLep, JETS_TYPE_CALO_CORR    , JETS_CLEAN_SINGLE_E );
+                            ht_calo_           = (float) sumPt (iLep, JETS_TYPE_CALO_UNCORR  , JETS_CLEAN_SINGLE_E );
+                            ht_calo_L2L3_      = (float) sumPt (iLep, JETS_TYPE_CALO_CORR    , JETS_CLEAN_SINGLE_E );
 #endif
-                        ht_pf_             = (float) sumPt (iLep, JETS_TYPE_PF_UNCORR    , JETS_CLEAN_SINGLE_E );
-                        ht_pf_L2L3_        = (float) sumPt (iLep, JETS_TYPE_PF_CORR      , JETS_CLEAN_SINGLE_E );
-                        ht_pf_L1FastL2L3_  = (float) sumPt (iLep, JETS_TYPE_PF_FAST_CORR , JETS_CLEAN_SINGLE_E );
+                            ht_pf_             = (float) sumPt (iLep, JETS_TYPE_PF_UNCORR    , JETS_CLEAN_SINGLE_E );
+                            ht_pf_L2L3_        = (float) sumPt (iLep, JETS_TYPE_PF_CORR      , JETS_CLEAN_SINGLE_E );
+                            ht_pf_L1FastL2L3_  = (float) sumPt (iLep, JETS_TYPE_PF_FAST_CORR , JETS_CLEAN_SINGLE_E );
+                        }
 
                         //////////////////////////// 
                         // End Lepton Information //
@@ -2762,76 +2683,79 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         // 2012 Triggers     //
                         ///////////////////////
 
-                        // Electrons
-                        triggerMatchStruct struct_ele8_CaloIdL_CaloIsoVL_vstar                                = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdL_CaloIsoVL_regexp                               );
-                        triggerMatchStruct struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar               = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_regexp              );
-                        triggerMatchStruct struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar         = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_regexp        );
-                        triggerMatchStruct struct_ele8_CaloIdT_TrkIdVL_vstar                                  = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdT_TrkIdVL_regexp                                 );
-                        triggerMatchStruct struct_ele8_CaloIdT_TrkIdVL_Jet30_vstar                            = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdT_TrkIdVL_Jet30_regexp                           );
-                        triggerMatchStruct struct_ele17_CaloIdL_CaloIsoVL_vstar                               = MatchTriggerClass(els_p4().at(iLep), ele17_CaloIdL_CaloIsoVL_regexp                              );
-                        triggerMatchStruct struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar              = MatchTriggerClass(els_p4().at(iLep), ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_regexp             );
-                        triggerMatchStruct struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar        = MatchTriggerClass(els_p4().at(iLep), ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_regexp       );
-                        triggerMatchStruct struct_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar = MatchTriggerClass(els_p4().at(iLep), ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_rexexp);
-                        triggerMatchStruct struct_ele27_WP80_vstar                                            = MatchTriggerClass(els_p4().at(iLep), ele27_WP80_rexexp                                           );
-
-                        ele8_CaloIdL_CaloIsoVL_vstar_                                      = struct_ele8_CaloIdL_CaloIsoVL_vstar.nHLTObjects_;
-                        ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                     = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.nHLTObjects_;
-                        ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_               = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.nHLTObjects_;
-                        ele8_CaloIdT_TrkIdVL_vstar_                                        = struct_ele8_CaloIdT_TrkIdVL_vstar.nHLTObjects_;
-                        ele8_CaloIdT_TrkIdVL_Jet30_vstar_                                  = struct_ele8_CaloIdT_TrkIdVL_Jet30_vstar.nHLTObjects_;
-                        ele17_CaloIdL_CaloIsoVL_vstar_                                     = struct_ele17_CaloIdL_CaloIsoVL_vstar.nHLTObjects_;
-                        ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                    = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.nHLTObjects_;
-                        ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_              = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.nHLTObjects_;
-                        ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_       = struct_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar.nHLTObjects_;
-                        ele27_WP80_vstar_                                                  = struct_ele27_WP80_vstar.nHLTObjects_;
-
-                        ele8_CaloIdL_CaloIsoVL_version_                                    = struct_ele8_CaloIdL_CaloIsoVL_vstar.version_;
-                        ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_                   = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.version_;
-                        ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_             = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.version_;
-                        ele8_CaloIdT_TrkIdVL_version_                                      = struct_ele8_CaloIdT_TrkIdVL_vstar.version_;
-                        ele8_CaloIdT_TrkIdVL_Jet30_version_                                = struct_ele8_CaloIdT_TrkIdVL_Jet30_vstar.version_;
-                        ele17_CaloIdL_CaloIsoVL_version_                                   = struct_ele17_CaloIdL_CaloIsoVL_vstar.version_;
-                        ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_                  = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.version_;
-                        ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_            = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.version_;
-                        ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_version_     = struct_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar.version_;
-                        ele27_WP80_version_                                                = struct_ele27_WP80_vstar.version_;
-
-                        dr_ele8_CaloIdL_CaloIsoVL_vstar_                                   = struct_ele8_CaloIdL_CaloIsoVL_vstar.dR_;
-                        dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                  = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.dR_;
-                        dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_            = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.dR_;
-                        dr_ele8_CaloIdT_TrkIdVL_vstar_                                     = struct_ele8_CaloIdT_TrkIdVL_vstar.dR_;
-                        dr_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                               = struct_ele8_CaloIdT_TrkIdVL_Jet30_vstar.dR_;
-                        dr_ele17_CaloIdL_CaloIsoVL_vstar_                                  = struct_ele17_CaloIdL_CaloIsoVL_vstar.dR_;
-                        dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                 = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.dR_;
-                        dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_           = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.dR_;
-                        dr_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_    = struct_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar.dR_;
-                        dr_ele27_WP80_vstar_                                               = struct_ele27_WP80_vstar.dR_;
-
-                        hltps_ele8_CaloIdL_CaloIsoVL_vstar_                                = struct_ele8_CaloIdL_CaloIsoVL_vstar.hltps_;
-                        hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_               = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.hltps_;
-                        hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_         = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.hltps_;
-                        hltps_ele8_CaloIdT_TrkIdVL_vstar_                                  = struct_ele8_CaloIdT_TrkIdVL_vstar.hltps_;
-                        hltps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                            = struct_ele8_CaloIdT_TrkIdVL_Jet30_vstar.hltps_;
-                        hltps_ele17_CaloIdL_CaloIsoVL_vstar_                               = struct_ele17_CaloIdL_CaloIsoVL_vstar.hltps_;
-                        hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_              = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.hltps_;
-                        hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_        = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.hltps_;
-                        hltps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_ = struct_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar.hltps_;
-                        hltps_ele27_WP80_vstar_                                            = struct_ele27_WP80_vstar.hltps_;
-
-                        // These are hardcoded to the value in Dima's table:
-                        // http://dmytro.web.cern.ch/dmytro/trigger/triggerEvolution_all.html
+                        if (BranchGroupSelected(kBabyTriggers2012))
+                        {
+                            // Electrons
+                            triggerMatchStruct struct_ele8_CaloIdL_CaloIsoVL_vstar                                = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdL_CaloIsoVL_regexp                               );
+                            triggerMatchStruct struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar               = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_regexp              );
+                            triggerMatchStruct struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar         = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_regexp        );
+                            triggerMatchStruct struct_ele8_CaloIdT_TrkIdVL_vstar                                  = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdT_TrkIdVL_regexp                                 );
+                            triggerMatchStruct struct_ele8_CaloIdT_TrkIdVL_Jet30_vstar                            = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdT_TrkIdVL_Jet30_regexp                           );
+                            triggerMatchStruct struct_ele17_CaloIdL_CaloIsoVL_vstar                               = MatchTriggerClass(els_p4().at(iLep), ele17_CaloIdL_CaloIsoVL_regexp                              );
+                            triggerMatchStruct struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar              = MatchTriggerClass(els_p4().at(iLep), ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_regexp             );
+                            triggerMatchStruct struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar        = MatchTriggerClass(els_p4().at(iLep), ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_regexp       );
+                            triggerMatchStruct struct_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar = MatchTriggerClass(els_p4().at(iLep), ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_rexexp);
+                            triggerMatchStruct struct_ele27_WP80_vstar                                            = MatchTriggerClass(els_p4().at(iLep), ele27_WP80_rexexp                                           );
+
+                            ele8_CaloIdL_CaloIsoVL_vstar_                                      = struct_ele8_CaloIdL_CaloIsoVL_vstar.nHLTObjects_;
+                            ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                     = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.nHLTObjects_;
+                            ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_               = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.nHLTObjects_;
+                            ele8_CaloIdT_TrkIdVL_vstar_                                        = struct_ele8_CaloIdT_TrkIdVL_vstar.nHLTObjects_;
+                            ele8_CaloIdT_TrkIdVL_Jet30_vstar_                                  = struct_ele8_CaloIdT_TrkIdVL_Jet30_vstar.nHLTObjects_;
+                            ele17_CaloIdL_CaloIsoVL_vstar_                                     = struct_ele17_CaloIdL_CaloIsoVL_vstar.nHLTObjects_;
+                            ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                    = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.nHLTObjects_;
+                            ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_              = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.nHLTObjects_;
+                            ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_       = struct_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar.nHLTObjects_;
+                            ele27_WP80_vstar_                                                  = struct_ele27_WP80_vstar.nHLTObjects_;
+
+                            ele8_CaloIdL_CaloIsoVL_version_                                    = struct_ele8_CaloIdL_CaloIsoVL_vstar.version_;
+                            ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_                   = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.version_;
+                            ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_             = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.version_;
+                            ele8_CaloIdT_TrkIdVL_version_                                      = struct_ele8_CaloIdT_TrkIdVL_vstar.version_;
+                            ele8_CaloIdT_TrkIdVL_Jet30_version_                                = struct_ele8_CaloIdT_TrkIdVL_Jet30_vstar.version_;
+                            ele17_CaloIdL_CaloIsoVL_version_                                   = struct_ele17_CaloIdL_CaloIsoVL_vstar.version_;
+                            ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_version_                  = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.version_;
+                            ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_version_            = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.version_;
+                            ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_version_     = struct_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar.version_;
+                            ele27_WP80_version_                                                = struct_ele27_WP80_vstar.version_;
+
+                            dr_ele8_CaloIdL_CaloIsoVL_vstar_                                   = struct_ele8_CaloIdL_CaloIsoVL_vstar.dR_;
+                            dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                  = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.dR_;
+                            dr_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_            = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.dR_;
+                            dr_ele8_CaloIdT_TrkIdVL_vstar_                                     = struct_ele8_CaloIdT_TrkIdVL_vstar.dR_;
+                            dr_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                               = struct_ele8_CaloIdT_TrkIdVL_Jet30_vstar.dR_;
+                            dr_ele17_CaloIdL_CaloIsoVL_vstar_                                  = struct_ele17_CaloIdL_CaloIsoVL_vstar.dR_;
+                            dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                 = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.dR_;
+                            dr_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_           = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.dR_;
+                            dr_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_    = struct_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar.dR_;
+                            dr_ele27_WP80_vstar_                                               = struct_ele27_WP80_vstar.dR_;
+
+                            hltps_ele8_CaloIdL_CaloIsoVL_vstar_                                = struct_ele8_CaloIdL_CaloIsoVL_vstar.hltps_;
+                            hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_               = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.hltps_;
+                            hltps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_         = struct_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.hltps_;
+                            hltps_ele8_CaloIdT_TrkIdVL_vstar_                                  = struct_ele8_CaloIdT_TrkIdVL_vstar.hltps_;
+                            hltps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                            = struct_ele8_CaloIdT_TrkIdVL_Jet30_vstar.hltps_;
+                            hltps_ele17_CaloIdL_CaloIsoVL_vstar_                               = struct_ele17_CaloIdL_CaloIsoVL_vstar.hltps_;
+                            hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_              = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar.hltps_;
+                            hltps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_        = struct_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar.hltps_;
+                            hltps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_ = struct_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar.hltps_;
+                            hltps_ele27_WP80_vstar_                                            = struct_ele27_WP80_vstar.hltps_;
+
+                            // These are hardcoded to the value in Dima's table:
+                            // http://dmytro.web.cern.ch/dmytro/trigger/triggerEvolution_all.html
 #ifndef __CMS2_SLIM__
-                        l1ps_ele8_CaloIdL_CaloIsoVL_vstar_                                    = L1_prescale("L1_SingleEG5");
-                        l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                   = L1_prescale("L1_SingleEG7");
-                        l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_             = L1_prescale("L1_SingleEG7");
-                        l1ps_ele8_CaloIdT_TrkIdVL_vstar_                                      = L1_prescale("L1_SingleEG5");
-                        l1ps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                                = L1_prescale("L1_SingleEG5");
-                        l1ps_ele17_CaloIdL_CaloIsoVL_vstar_                                   = L1_prescale("L1_SingleEG12");
-                        l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                  = L1_prescale("L1_SingleEG12");
-                        l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_            = L1_prescale("L1_SingleEG12");
-                        l1ps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_     = L1_prescale("L1_SingleEG20");
-                        l1ps_ele27_WP80_vstar_                                                = L1_prescale("L1_SingleEG20");
+                            l1ps_ele8_CaloIdL_CaloIsoVL_vstar_                                    = L1_prescale("L1_SingleEG5");
+                            l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                   = L1_prescale("L1_SingleEG7");
+                            l1ps_ele8_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_             = L1_prescale("L1_SingleEG7");
+                            l1ps_ele8_CaloIdT_TrkIdVL_vstar_                                      = L1_prescale("L1_SingleEG5");
+                            l1ps_ele8_CaloIdT_TrkIdVL_Jet30_vstar_                                = L1_prescale("L1_SingleEG5");
+                            l1ps_ele17_CaloIdL_CaloIsoVL_vstar_                                   = L1_prescale("L1_SingleEG12");
+                            l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_vstar_                  = L1_prescale("L1_SingleEG12");
+                            l1ps_ele17_CaloIdT_CaloIsoVL_TrkIdVL_TrkIsoVL_Jet30_vstar_            = L1_prescale("L1_SingleEG12");
+                            l1ps_ele25_CaloIdVT_CaloIsoT_TrkIdT_TrkIsoT_CentralPFJet30_vstar_     = L1_prescale("L1_SingleEG20");
+                            l1ps_ele27_WP80_vstar_                                                = L1_prescale("L1_SingleEG20");
 #endif
+                        }
 
 
                         ///////////////////////  
@@ -2843,36 +2767,39 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         ///////////////////////
 
 
-                        // Electrons
-                        triggerMatchStruct struct_ele8_vstar                                          = MatchTriggerClass(els_p4().at(iLep), ele8_regexp                                         );
-                        triggerMatchStruct struct_ele8_CaloIdL_TrkIdVL_vstar                          = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdL_TrkIdVL_regexp                         );
-                        triggerMatchStruct struct_ele8_CaloIdL_CaloIsoVL_Jet40_vstar                  = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdL_CaloIsoVL_Jet40_regexp                 );
-                        triggerMatchStruct struct_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar       = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_regexp);
-                        triggerMatchStruct struct_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar = MatchTriggerClass(els_p4().at(iLep), photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_regexp);
-
-                        ele8_vstar_                                             = struct_ele8_vstar.nHLTObjects_;
-                        ele8_CaloIdL_TrkIdVL_vstar_                             = struct_ele8_CaloIdL_TrkIdVL_vstar.nHLTObjects_; 
-                        ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                     = struct_ele8_CaloIdL_CaloIsoVL_Jet40_vstar.nHLTObjects_;
-                        ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_          = struct_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar.nHLTObjects_;
-                        photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_    = struct_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar.nHLTObjects_;
-
-                        ele8_version_                                           = struct_ele8_vstar.version_;
-                        ele8_CaloIdL_TrkIdVL_version_                           = struct_ele8_CaloIdL_TrkIdVL_vstar.version_; 
-                        ele8_CaloIdL_CaloIsoVL_Jet40_version_                   = struct_ele8_CaloIdL_CaloIsoVL_Jet40_vstar.version_;
-                        ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_version_        = struct_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar.version_;
-                        photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_version_  = struct_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar.nHLTObjects_;
-
-                        dr_ele8_vstar_                                          = struct_ele8_vstar.dR_;
-                        dr_ele8_CaloIdL_TrkIdVL_vstar_                          = struct_ele8_CaloIdL_TrkIdVL_vstar.dR_;
-                        dr_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                  = struct_ele8_CaloIdL_CaloIsoVL_Jet40_vstar.dR_;
-                        dr_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_       = struct_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar.dR_;
-                        dr_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_ = struct_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar.dR_; 
-
-                        hltps_ele8_vstar_                                          = struct_ele8_vstar.hltps_;
-                        hltps_ele8_CaloIdL_TrkIdVL_vstar_                          = struct_ele8_CaloIdL_TrkIdVL_vstar.hltps_;
-                        hltps_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                  = struct_ele8_CaloIdL_CaloIsoVL_Jet40_vstar.hltps_;
-                        hltps_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_       = struct_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar.hltps_;
-                        hltps_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_ = struct_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar.hltps_; 
+                        if (BranchGroupSelected(kBabyTriggers2011))
+                        {
+                            // Electrons
+                            triggerMatchStruct struct_ele8_vstar                                          = MatchTriggerClass(els_p4().at(iLep), ele8_regexp                                         );
+                            triggerMatchStruct struct_ele8_CaloIdL_TrkIdVL_vstar                          = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdL_TrkIdVL_regexp                         );
+                            triggerMatchStruct struct_ele8_CaloIdL_CaloIsoVL_Jet40_vstar                  = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdL_CaloIsoVL_Jet40_regexp                 );
+                            triggerMatchStruct struct_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar       = MatchTriggerClass(els_p4().at(iLep), ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_regexp);
+                            triggerMatchStruct struct_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar = MatchTriggerClass(els_p4().at(iLep), photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_regexp);
+
+                            ele8_vstar_                                             = struct_ele8_vstar.nHLTObjects_;
+                            ele8_CaloIdL_TrkIdVL_vstar_                             = struct_ele8_CaloIdL_TrkIdVL_vstar.nHLTObjects_; 
+                            ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                     = struct_ele8_CaloIdL_CaloIsoVL_Jet40_vstar.nHLTObjects_;
+                            ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_          = struct_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar.nHLTObjects_;
+                            photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_    = struct_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar.nHLTObjects_;
+
+                            ele8_version_                                           = struct_ele8_vstar.version_;
+                            ele8_CaloIdL_TrkIdVL_version_                           = struct_ele8_CaloIdL_TrkIdVL_vstar.version_; 
+                            ele8_CaloIdL_CaloIsoVL_Jet40_version_                   = struct_ele8_CaloIdL_CaloIsoVL_Jet40_vstar.version_;
+                            ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_version_        = struct_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar.version_;
+                            photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_version_  = struct_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar.nHLTObjects_;
+
+                            dr_ele8_vstar_                                          = struct_ele8_vstar.dR_;
+                            dr_ele8_CaloIdL_TrkIdVL_vstar_                          = struct_ele8_CaloIdL_TrkIdVL_vstar.dR_;
+                            dr_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                  = struct_ele8_CaloIdL_CaloIsoVL_Jet40_vstar.dR_;
+                            dr_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_       = struct_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar.dR_;
+                            dr_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_ = struct_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar.dR_; 
+
+                            hltps_ele8_vstar_                                          = struct_ele8_vstar.hltps_;
+                            hltps_ele8_CaloIdL_TrkIdVL_vstar_                          = struct_ele8_CaloIdL_TrkIdVL_vstar.hltps_;
+                            hltps_ele8_CaloIdL_CaloIsoVL_Jet40_vstar_                  = struct_ele8_CaloIdL_CaloIsoVL_Jet40_vstar.hltps_;
+                            hltps_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar_       = struct_ele8_CaloIdT_TrkIdVL_CaloIsoVL_TrkIsoVL_vstar.hltps_;
+                            hltps_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar_ = struct_photon20_CaloIdVT_IsoT_Ele8_CaloIdL_CaloIsoVL_vstar.hltps_; 
+                        }
 
                         ///////////////////////  
                         // end 2011 Triggers //
@@ -2905,196 +2832,11 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         //                     }
                         // #endif
 
-                        // PF Jets
-                        // Find the highest Pt pfjet separated by at least dRcut from this lepton and fill the pfjet Pt
-                        ptpfj1_       = -999.0;
-                        ptpfj1_b2b_   = -999.0;
-                        dphipfj1_b2b_ = -999.0;
-                        npfj1_        = 0;
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            double dr = ROOT::Math::VectorUtil::DeltaR( els_p4().at(iLep), pfjets_p4().at(iJet) );
-                            if( dr > deltaRCut && pfjets_p4().at(iJet).pt() > 10 ) npfj1_++;
-                            if ( dr > deltaRCut && pfjets_p4().at(iJet).pt() > ptpfj1_ ){
-                                ptpfj1_ = pfjets_p4().at(iJet).pt();
-
-                                // back to back in phi
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( els_p4().at(iLep), pfjets_p4().at(iJet) ) );
-                                if( dphi > deltaPhiCut && pfjets_p4().at(iJet).pt() > ptpfj1_b2b_ ){ 
-                                    ptpfj1_b2b_   = pfjets_p4().at(iJet).pt();
-                                    dphipfj1_b2b_ = dphi;
-                                }
-                            }
-                        }
-
-                        // L2L3 PF Jets
-                        // Find the highest Pt PF L2L3 corrected jet separated by at least dRcut from this lepton and fill the jet Pt
-                        ptpfcj1_       = -999.0; 
-                        ptpfcj1_b2b_   = -999.0;
-                        dphipfcj1_b2b_ = -999.0;
-                        npfcj1_        = 0;
-                        btagpfc_       = false;
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            if ( !passesPFJetID(iJet)) continue;
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = jetCorrection(jp4, jet_pf_L2L3corrector);
-                            //float jet_cor = pfjets_corL2L3().at(iJet);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            if (jp4cor.pt() > 15 && pfjets_combinedSecondaryVertexBJetTag().at(iJet) > 0.679) btagpfc_ = true;
-                            double dr = ROOT::Math::VectorUtil::DeltaR( els_p4().at(iLep), jp4cor );
-                            if( dr > deltaRCut && jp4cor.pt() > 10 ) npfcj1_++;
-                            if ( dr > deltaRCut && jp4cor.pt() > ptpfcj1_ ){
-                                ptpfcj1_ = jp4cor.pt();
-
-                                // back to back in phi
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( els_p4().at(iLep), jp4cor ) );
-                                if( dphi > deltaPhiCut && jp4cor.pt() > ptpfcj1_b2b_ ){
-                                    ptpfcj1_b2b_   = jp4cor.pt();
-                                    dphipfcj1_b2b_ = dphi;
-                                } 
-                            }
-                        }
-
-                        // L1FastL2L3 PF Jets
-                        // Find the highest Pt PF L1FastL2L3 corrected jet separated by at least dRcut from this lepton and fill the jet Pt
-                        emfpfcL1Fj1_      = -999.0;
-                        ptpfcL1Fj1_       = -999.0;
-                        dphipfcL1Fj1_     = -999.0;
-                        ptpfcL1Fj1_b2b_   = -999.0;
-                        dphipfcL1Fj1_b2b_ = -999.0;
-                        npfcL1Fj1_        = 0;
-                        npfc30L1Fj1_      = 0;
-                        npfc40L1Fj1_      = 0;
-                        nbpfc40L1Fj1_     = 0;
-                        npfc50L1Fj1_eth_  = 0;
-                        npfc65L1Fj1_eth_  = 0;
-                        btagpfcL1F_       = false;
-                        rho_ = cms2.evt_rho();
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            if ( !passesPFJetID(iJet)) continue;
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = cms2.pfjets_corL1FastL2L3().at(iJet);
-                            //jet_pf_L1FastJetL2L3_corrector->setRho(cms2.evt_ww_rho_vor());
-                            //jet_pf_L1FastJetL2L3_corrector->setJetA(cms2.pfjets_area().at(iJet));
-                            //jet_pf_L1FastJetL2L3_corrector->setJetPt(cms2.pfjets_p4().at(iJet).pt());
-                            //jet_pf_L1FastJetL2L3_corrector->setJetEta(cms2.pfjets_p4().at(iJet).eta()); 
-                            //float jet_cor = jetCorrection(jp4, jet_pf_L1FastJetL2L3_corrector);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            if (jp4cor.pt() > 15 && pfjets_combinedSecondaryVertexBJetTag().at(iJet) > 0.679) btagpfcL1F_ = true;
-                            double dr = ROOT::Math::VectorUtil::DeltaR( els_p4().at(iLep), jp4cor );
-                            if( dr > deltaRCut && jp4cor.pt() > 10 ) npfcL1Fj1_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 30 ) npfc30L1Fj1_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 40 ) npfc40L1Fj1_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 40 && pfjets_combinedSecondaryVertexBJetTag().at(iJet) > 0.679) nbpfc40L1Fj1_++;
-                            if (dr > 0.4       && jp4cor.pt() > 50 ) npfc50L1Fj1_eth_++;
-                            if (dr > 0.4       && jp4cor.pt() > 65 ) npfc65L1Fj1_eth_++;
-                            if ( dr > deltaRCut && jp4cor.pt() > ptpfcL1Fj1_ ){
-                                emfpfcL1Fj1_ = (cms2.pfjets_chargedEmE().at(iJet) + cms2.pfjets_neutralEmE().at(iJet)) / pfjets_p4().at(iJet).E();
-                                ptpfcL1Fj1_ = jp4cor.pt();
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( els_p4().at(iLep), jp4cor ) );
-                                dphipfcL1Fj1_ = dphi;
-
-                                // back to back in phi
-                                if( dphi > deltaPhiCut && jp4cor.pt() > ptpfcL1Fj1_b2b_ ){
-                                    ptpfcL1Fj1_b2b_   = jp4cor.pt();
-                                    dphipfcL1Fj1_b2b_ = dphi;
-                                }
-                            }
-                        }
-
-                        // L1FastL2L3Residual PF Jets
-                        // Find the highest Pt PF L1FastL2L3Residual corrected jet separated by at least dRcut from this lepton and fill the jet Pt
-                        emfpfcL1Fj1res_      = -999.0;
-                        ptpfcL1Fj1res_       = -999.0;
-                        dphipfcL1Fj1res_      = -999.0;
-                        ptpfcL1Fj1res_b2b_   = -999.0;
-                        dphipfcL1Fj1res_b2b_ = -999.0;
-                        npfcL1Fj1res_        = 0;
-                        npfc30L1Fj1res_      = 0;
-                        npfc40L1Fj1res_      = 0;
-                        nbpfc40L1Fj1res_     = 0;
-                        npfc50L1Fj1res_eth_  = 0;
-                        npfc65L1Fj1res_eth_  = 0;
-                        btagpfcL1Fres_       = false;
-                        rho_ = cms2.evt_rho();
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            if ( !passesPFJetID(iJet)) continue;
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = cms2.pfjets_corL1FastL2L3residual().at(iJet);
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setRho(cms2.evt_ww_rho_vor());
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetA(cms2.pfjets_area().at(iJet));
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetPt(cms2.pfjets_p4().at(iJet).pt());
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetEta(cms2.pfjets_p4().at(iJet).eta()); 
-                            //float jet_cor = jetCorrection(jp4, jet_pf_L1FastJetL2L3Residual_corrector);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            if (jp4cor.pt() > 15 && pfjets_combinedSecondaryVertexBJetTag().at(iJet) > 0.679) btagpfcL1Fres_ = true;
-                            double dr = ROOT::Math::VectorUtil::DeltaR( els_p4().at(iLep), jp4cor );
-                            if( dr > deltaRCut && jp4cor.pt() > 10 ) npfcL1Fj1res_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 30 ) npfc30L1Fj1res_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 40 ) npfc40L1Fj1res_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 40 && pfjets_combinedSecondaryVertexBJetTag().at(iJet) > 0.679) nbpfc40L1Fj1res_++;
-                            if (dr > 0.4       && jp4cor.pt() > 50 ) npfc50L1Fj1res_eth_++;
-                            if (dr > 0.4       && jp4cor.pt() > 65 ) npfc65L1Fj1res_eth_++;
-                            if ( dr > deltaRCut && jp4cor.pt() > ptpfcL1Fj1res_ ){
-                                emfpfcL1Fj1res_ = (cms2.pfjets_chargedEmE().at(iJet) + cms2.pfjets_neutralEmE().at(iJet)) / pfjets_p4().at(iJet).E();
-                                ptpfcL1Fj1res_ = jp4cor.pt();
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( els_p4().at(iLep), jp4cor ) );
-                                dphipfcL1Fj1res_ = dphi;
-
-                                // back to back in phi
-                                if( dphi > deltaPhiCut && jp4cor.pt() > ptpfcL1Fj1res_b2b_ ){
-                                    ptpfcL1Fj1res_b2b_   = jp4cor.pt();
-                                    dphipfcL1Fj1res_b2b_ = dphi;
-                                }
-                            }
-                        }
-
-                        // *** Doing B-tagging correctly ***
-                        // B-tagged L1FastL2L3 PF Jets
-                        // Find the highest Pt B-tagged PF L1FastL2L3 corrected jet separated by at least dRcut from this lepton and fill the jet Pt
-                        ptbtagpfcL1Fj1_       = -999.0;
-                        dphibtagpfcL1Fj1_       = -999.0;
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            if ( !passesPFJetID(iJet)) continue;
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = cms2.pfjets_corL1FastL2L3().at(iJet);
-                            //jet_pf_L1FastJetL2L3_corrector->setRho(cms2.evt_ww_rho_vor());
-                            //jet_pf_L1FastJetL2L3_corrector->setJetA(cms2.pfjets_area().at(iJet));
-                            //jet_pf_L1FastJetL2L3_corrector->setJetPt(cms2.pfjets_p4().at(iJet).pt());
-                            //jet_pf_L1FastJetL2L3_corrector->setJetEta(cms2.pfjets_p4().at(iJet).eta()); 
-                            //float jet_cor = jetCorrection(jp4, jet_pf_L1FastJetL2L3_corrector);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            if (pfjets_combinedSecondaryVertexBJetTag().at(iJet) < 0.679) continue;
-                            double dr = ROOT::Math::VectorUtil::DeltaR( els_p4().at(iLep), jp4cor );
-                            if ( dr > deltaRCut && jp4cor.pt() > ptbtagpfcL1Fj1_ ){
-                                ptbtagpfcL1Fj1_ = jp4cor.pt();
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( els_p4().at(iLep), jp4cor ) );
-                                dphibtagpfcL1Fj1_ = dphi; 
-                            }
-                        }
+                        // PF Jets at all correction levels (raw, L2L3, L1FastL2L3, L1FastL2L3Residual and b-tagged)
+                        // Find the highest Pt jets separated by at least dRcut from this lepton and count the jets
+                        if (BranchGroupSelected(kBabyJets))
+                            FillJetVariables(jetCache, els_p4().at(iLep), deltaRCut, deltaPhiCut, PFJetCache::L2L3);
 
-                        // *** Doing B-tagging correctly ***
-                        // B-tagged L1FastL2L3Residual PF Jets
-                        // Find the highest Pt B-tagged PF L1FastL2L3Residual corrected jet separated by at least dRcut from this lepton and fill the jet Pt
-                        ptbtagpfcL1Fj1res_       = -999.0;
-                        dphibtagpfcL1Fj1res_       = -999.0;
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            if ( !passesPFJetID(iJet)) continue;
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = cms2.pfjets_corL1FastL2L3residual().at(iJet);
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setRho(cms2.evt_ww_rho_vor());
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetA(cms2.pfjets_area().at(iJet));
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetPt(cms2.pfjets_p4().at(iJet).pt());
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetEta(cms2.pfjets_p4().at(iJet).eta()); 
-                            //float jet_cor = jetCorrection(jp4, jet_pf_L1FastJetL2L3Residual_corrector);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            if (pfjets_combinedSecondaryVertexBJetTag().at(iJet) < 0.679) continue;
-                            double dr = ROOT::Math::VectorUtil::DeltaR( els_p4().at(iLep), jp4cor );
-                            if ( dr > deltaRCut && jp4cor.pt() > ptbtagpfcL1Fj1res_ ){
-                                ptbtagpfcL1Fj1res_ = jp4cor.pt();
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( els_p4().at(iLep), jp4cor ) );
-                                dphibtagpfcL1Fj1res_ = dphi; 
-                            }
-                        }
                         //////////////
                         // End Jets //
                         //////////////
@@ -3118,19 +2860,7 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         // #endif
 
                         // btag info for corrected pfjet
-                        nbpfcjet_ = this_nbpfjet;
-                        dRbpfcNear_ = 99.;
-                        dRbpfcFar_  = -99.;
-                        for (int ii=0; ii<nbpfcjet_; ii++) {
-                            unsigned int iJet = bpfindex.at(ii);
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = jetCorrection(jp4, jet_pf_L2L3corrector);
-                            //float jet_corr = pfjets_corL2L3().at(iJet);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            float dr = ROOT::Math::VectorUtil::DeltaR( els_p4().at(iLep), jp4cor);
-                            if (dr < dRbpfcNear_) dRbpfcNear_ = dr;
-                            if (dr > dRbpfcFar_)   dRbpfcFar_  = dr;
-                        }
+                        // filled with the jets (see FillJetVariables)
 
                         ///////////////////
                         // End B Tagging //
@@ -3175,111 +2905,6 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         // Initialize baby ntuple
                         InitBabyNtuple();
 
-                        // store number of electron FOs in event (use SS FO definition)
-                        nFOels_ = 0;
-                        ngsfs_ = 0;
-                        for (unsigned int iel = 0; iel < cms2.els_p4().size(); iel++) {
-                            if (cms2.els_p4().at(iel).pt() < 10.)
-                                continue;
-
-                            if (pass_electronSelection(iel, electronSelectionFOV7_v3, false, false))
-                                ++ngsfs_;
-
-                            if (samesign::isDenominatorLepton(11, iel)) {
-                                ++nFOels_;
-                                if (cms2.els_p4().at(iel).pt() > foel_p4_.pt()) {
-                                    foel_p4_ = cms2.els_p4().at(iel);
-                                    foel_id_ = 11*cms2.els_charge().at(iel);
-                                }
-                                continue;
-                            }
-                            if (samesign::isDenominatorLepton(11, iel)) {
-                                ++nFOels_;
-                                if (cms2.els_p4().at(iel).pt() > foel_p4_.pt()) {
-                                    foel_p4_ = cms2.els_p4().at(iel);
-                                    foel_id_ = 11*cms2.els_charge().at(iel);
-                                }
-                                continue;
-                            }
-                        }
-
-                        // store number of muon FOs in event (use SS FO definition)
-                        nFOmus_ = 0;
-                        nmus_ = 0;
-                        for (unsigned int imu = 0; imu < cms2.mus_p4().size(); imu++) {
-                            if (imu == iLep)
-                                continue;
-
-                            if (cms2.mus_p4().at(imu).pt() < 10.)
-                                continue;
-
-                            if (muonIdNotIsolated(imu, muonSelectionFO_ssV5))
-                                ++nmus_;
-
-                            if (samesign::isDenominatorLepton(13, imu)) {
-                                ++nFOmus_;
-                                if (cms2.mus_p4().at(imu).pt() > fomu_p4_.pt() && imu != iLep) {
-                                    fomu_p4_ = cms2.mus_p4().at(imu);
-                                    fomu_id_ = 13*cms2.mus_charge().at(imu);
-                                }
-                                continue;
-                            }
-                            if (samesign::isDenominatorLepton(13, imu)) {
-                                ++nFOmus_;
-                                if (cms2.mus_p4().at(imu).pt() > fomu_p4_.pt() && imu != iLep) {
-                                    fomu_p4_ = cms2.mus_p4().at(imu);
-                                    fomu_id_ = 13*cms2.mus_charge().at(imu);
-                                }
-                                continue;
-                            }
-                        }
-
-                        // store number of "veto" electrons in event
-                        nvetoels_ = 0;
-                        for (unsigned int iel = 0; iel < cms2.els_p4().size(); iel++)
-                        {
-                            if (cms2.els_p4().at(iel).pt() < 5.0f)
-                                continue;
-
-                            if (fabs(cms2.els_p4().at(iel).eta()) > 2.4f)
-                                continue;
-
-                            const float iso = electronIsoValuePF2012_FastJetEffArea_v3(iel, /*conesize=*/0.3, /*vtx=*/-999, /*52X iso=*/false);
-                            if (iso > 1.0)
-                                continue;
-
-                            // if we get here, then count it
-                            nvetoels_++;
-                        }
-
-                        // store number of "veto" muons in event
-                        nvetomus_ = 0;
-                        for (unsigned int imu = 0; imu < cms2.mus_p4().size(); imu++)
-                        {
-                            if (imu == iLep) // skip the current muon
-                                continue;
-
-                            if (cms2.mus_p4().at(imu).pt() < 5.0f)
-                                continue;
-
-                            if (fabs(cms2.mus_p4().at(imu).eta()) > 2.4f)
-                                continue;
-
-                            const bool is_global      = ((cms2.mus_type().at(imu) & (1<<1)) != 0);
-                            const bool is_tracker     = ((cms2.mus_type().at(imu) & (1<<2)) != 0);
-                            const bool is_pfmu        = ((cms2.mus_type().at(imu) & (1<<5)) != 0);
-                            const bool passes_mu_type = ((is_global or is_tracker) and is_pfmu);
-                            if (not passes_mu_type)
-                                continue;
-
-                            const float iso = muonIsoValuePF2012_deltaBeta(imu); 
-                            if (iso > 1.0)
-                                continue;
-
-                            // if we get here, then count it
-                            nvetomus_++;
-                        }
-
                         ////////////////////////////////////////////////////////////////////////
                         // STORE SOME Z MASS VARIABLES //
                         ////////////////////////////////////////////////////////////////////////
@@ -3315,41 +2940,9 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         // Event Information     //
                         ///////////////////////////
 
-                        // Load the electron and event quantities
-                        run_          = evt_run();
-                        ls_           = evt_lumiBlock();
-                        evt_          = evt_event();
-                        weight_       = isData ? 1.0 : evt_scale1fb();
-                        filename_     = f->GetName();
-                        dataset_      = evt_dataset().front();
-                        is_real_data_ = evt_isRealData();
-
-                        if(!isData){
-                            // Pileup - PUSummaryInfoMaker
-                            for (unsigned int vidx = 0; vidx < cms2.puInfo_nPUvertices().size(); vidx++) {
-                                if (cms2.puInfo_bunchCrossing().at(vidx) != 0)
-                                    continue;
-                                pu_nPUvertices_ = cms2.puInfo_nPUvertices().at(vidx);
-                                pu_nPUtrueint_  = cms2.puInfo_trueNumInteractions().at(vidx);
-                            }
-                        } 
-
-                        // Pileup - VertexMaker
-                        bool first_good_vertex_found         = false;
-                        unsigned int first_good_vertex_index = 0;
-                        for (unsigned int vidx = 0; vidx < cms2.vtxs_position().size(); vidx++)
-                        {
-                            if (!isGoodVertex(vidx))
-                            {
-                                continue;
-                            }
-                            if (!first_good_vertex_found)
-                            {
-                                first_good_vertex_found = true;
-                                first_good_vertex_index = vidx;
-                            }
-                            ++evt_nvtxs_;
-                        }
+                        // Load the event quantities
+                        FillEventInformation(eventContext);
+                        filename_idx_ = fileIndex;
 
                         /////////////////////////// 
                         // End Event Information //
@@ -3367,10 +2960,6 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         eta_       = mus_p4().at(iLep).eta();
                         phi_       = mus_p4().at(iLep).phi();
                         id_        = 13*mus_charge().at(iLep);
-                        pfmet_     = evt_pfmet();
-                        pfmetphi_  = evt_pfmetPhi();
-                        foel_mass_ = sqrt(fabs((lp4_ + foel_p4_).mass2()));
-                        fomu_mass_ = sqrt(fabs((lp4_ + fomu_p4_).mass2()));
 
                         // ip (2d and 3d)
                         const int mutkid = cms2.mus_trkidx().at(iLep);
@@ -3464,12 +3053,15 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         pfmt_ = Mt( mus_p4().at(iLep), pfmet_, pfmetphi_ );
 
                         // HT
+                        if (BranchGroupSelected(kBabyJets))
+                        {
 #ifndef __CMS2_SLIM__
-                        ht_calo_           = (float) sumPt (iLep, JETS_TYPE_CALO_UNCORR  , JETS_CLEAN_SINGLE_MU );
-                        ht_calo_L2L3_      = (float) sumPt (iLep, JETS_TYPE_CALO_CORR    , JETS_CLEAN_SINGLE_MU );
+                            ht_calo_           = (float) sumPt (iLep, JETS_TYPE_CALO_UNCORR  , JETS_CLEAN_SINGLE_MU );
+                            ht_calo_L2L3_      = (float) sumPt (iLep, JETS_TYPE_CALO_CORR    , JETS_CLEAN_SINGLE_MU );
 #endif
-                        ht_pf_             = (float) sumPt (iLep, JETS_TYPE_PF_UNCORR    , JETS_CLEAN_SINGLE_MU );
-                        ht_pf_L2L3_        = (float) sumPt (iLep, JETS_TYPE_PF_CORR      , JETS_CLEAN_SINGLE_MU );
+                            ht_pf_             = (float) sumPt (iLep, JETS_TYPE_PF_UNCORR    , JETS_CLEAN_SINGLE_MU );
+                            ht_pf_L2L3_        = (float) sumPt (iLep, JETS_TYPE_PF_CORR      , JETS_CLEAN_SINGLE_MU );
+                        }
 
                         //////////////////////////// 
                         // End Lepton Information //
@@ -3539,97 +3131,107 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         // End Fake Rate Numerator & Denominator Selections //
                         //////////////////////////////////////////////////////
 
+                        // number of additional objects in the event (the muon itself is not counted)
+                        if (!eventContext.hasLeptons)
+                            eventContext.FillLeptons();
+                        FillEventCounts(eventContext, /*eormu=*/13, iLep);
+                        foel_mass_ = sqrt(fabs((lp4_ + foel_p4_).mass2()));
+                        fomu_mass_ = sqrt(fabs((lp4_ + fomu_p4_).mass2()));
+
                         ///////////////////////  
                         // 2012 Triggers     //
                         ///////////////////////
 
-                        // Muons
-                        triggerMatchStruct struct_mu5_vstar             = MatchTriggerClass(mus_p4().at(iLep), mu5_regexp            , 13);
-                        triggerMatchStruct struct_mu8_vstar             = MatchTriggerClass(mus_p4().at(iLep), mu8_regexp            , 13);
-                        triggerMatchStruct struct_mu12_vstar            = MatchTriggerClass(mus_p4().at(iLep), mu12_regexp           , 13);
-                        triggerMatchStruct struct_mu17_vstar            = MatchTriggerClass(mus_p4().at(iLep), mu17_regexp           , 13);
-                        triggerMatchStruct struct_mu15_eta2p1_vstar     = MatchTriggerClass(mus_p4().at(iLep), mu15_eta2p1_regexp    , 13);
-                        triggerMatchStruct struct_mu24_eta2p1_vstar     = MatchTriggerClass(mus_p4().at(iLep), mu24_eta2p1_regexp    , 13);
-                        triggerMatchStruct struct_mu30_eta2p1_vstar     = MatchTriggerClass(mus_p4().at(iLep), mu30_eta2p1_regexp    , 13);
-                        triggerMatchStruct struct_isoMu20_eta2p1_vstar  = MatchTriggerClass(mus_p4().at(iLep), isoMu20_eta2p1_regexp , 13);
-                        triggerMatchStruct struct_isoMu24_eta2p1_vstar  = MatchTriggerClass(mus_p4().at(iLep), isoMu24_eta2p1_regexp , 13);
-                        triggerMatchStruct struct_isoMu30_eta2p1_vstar  = MatchTriggerClass(mus_p4().at(iLep), isoMu30_eta2p1_regexp , 13);
-                        triggerMatchStruct struct_relIso1p0Mu17_vstar   = MatchTriggerClass(mus_p4().at(iLep), relIso1p0Mu17_regexp  , 13);
-                        triggerMatchStruct struct_relIso1p0Mu20_vstar   = MatchTriggerClass(mus_p4().at(iLep), relIso1p0Mu20_regexp  , 13);
-                        triggerMatchStruct struct_relIso1p0Mu5_vstar    = MatchTriggerClass(mus_p4().at(iLep), relIso1p0Mu5_regexp   , 13);
-
-                        mu5_vstar_                  = struct_mu5_vstar.nHLTObjects_;
-                        mu8_vstar_                  = struct_mu8_vstar.nHLTObjects_;
-                        mu12_vstar_                 = struct_mu12_vstar.nHLTObjects_;
-                        mu17_vstar_                 = struct_mu17_vstar.nHLTObjects_;
-                        mu15_eta2p1_vstar_          = struct_mu15_eta2p1_vstar.nHLTObjects_;
-                        mu24_eta2p1_vstar_          = struct_mu24_eta2p1_vstar.nHLTObjects_;
-                        mu30_eta2p1_vstar_          = struct_mu30_eta2p1_vstar.nHLTObjects_;
-                        isoMu20_eta2p1_vstar_       = struct_isoMu20_eta2p1_vstar.nHLTObjects_;
-                        isoMu24_eta2p1_vstar_       = struct_isoMu24_eta2p1_vstar.nHLTObjects_;
-                        isoMu30_eta2p1_vstar_       = struct_isoMu30_eta2p1_vstar.nHLTObjects_;
-                        relIso1p0Mu17_vstar_        = struct_relIso1p0Mu17_vstar.nHLTObjects_;
-                        relIso1p0Mu20_vstar_        = struct_relIso1p0Mu20_vstar.nHLTObjects_;
-                        relIso1p0Mu5_vstar_         = struct_relIso1p0Mu5_vstar.nHLTObjects_;
-
-                        mu5_version_                = struct_mu5_vstar.version_;
-                        mu8_version_                = struct_mu8_vstar.version_;
-                        mu12_version_               = struct_mu12_vstar.version_;
-                        mu17_version_               = struct_mu17_vstar.version_;
-                        mu15_eta2p1_version_        = struct_mu15_eta2p1_vstar.version_;
-                        mu24_eta2p1_version_        = struct_mu24_eta2p1_vstar.version_;
-                        mu30_eta2p1_version_        = struct_mu30_eta2p1_vstar.version_;
-                        isoMu20_eta2p1_version_     = struct_isoMu20_eta2p1_vstar.version_;
-                        isoMu24_eta2p1_version_     = struct_isoMu24_eta2p1_vstar.version_;
-                        isoMu30_eta2p1_version_     = struct_isoMu30_eta2p1_vstar.version_;
-                        relIso1p0Mu17_version_      = struct_relIso1p0Mu17_vstar.version_;
-                        relIso1p0Mu20_version_      = struct_relIso1p0Mu20_vstar.version_;
-                        relIso1p0Mu5_version_       = struct_relIso1p0Mu5_vstar.version_;
-
-                        dr_mu5_vstar_               = struct_mu5_vstar.dR_;
-                        dr_mu8_vstar_               = struct_mu8_vstar.dR_;
-                        dr_mu12_vstar_              = struct_mu12_vstar.dR_;
-                        dr_mu17_vstar_              = struct_mu17_vstar.dR_;
-                        dr_mu15_eta2p1_vstar_       = struct_mu15_eta2p1_vstar.dR_;
-                        dr_mu24_eta2p1_vstar_       = struct_mu24_eta2p1_vstar.dR_;
-                        dr_mu30_eta2p1_vstar_       = struct_mu30_eta2p1_vstar.dR_;
-                        dr_isoMu20_eta2p1_vstar_    = struct_isoMu20_eta2p1_vstar.dR_;
-                        dr_isoMu24_eta2p1_vstar_    = struct_isoMu24_eta2p1_vstar.dR_;
-                        dr_isoMu30_eta2p1_vstar_    = struct_isoMu30_eta2p1_vstar.dR_;
-                        dr_relIso1p0Mu17_vstar_     = struct_relIso1p0Mu17_vstar.dR_;
-                        dr_relIso1p0Mu20_vstar_     = struct_relIso1p0Mu20_vstar.dR_;
-                        dr_relIso1p0Mu5_vstar_      = struct_relIso1p0Mu5_vstar.dR_;
-
-                        hltps_mu5_vstar_            = struct_mu5_vstar.hltps_;
-                        hltps_mu8_vstar_            = struct_mu8_vstar.hltps_;
-                        hltps_mu12_vstar_           = struct_mu12_vstar.hltps_;
-                        hltps_mu17_vstar_           = struct_mu17_vstar.hltps_;
-                        hltps_mu15_eta2p1_vstar_    = struct_mu15_eta2p1_vstar.hltps_;
-                        hltps_mu24_eta2p1_vstar_    = struct_mu24_eta2p1_vstar.hltps_;
-                        hltps_mu30_eta2p1_vstar_    = struct_mu30_eta2p1_vstar.hltps_;
-                        hltps_isoMu20_eta2p1_vstar_ = struct_isoMu20_eta2p1_vstar.hltps_;
-                        hltps_isoMu24_eta2p1_vstar_ = struct_isoMu24_eta2p1_vstar.hltps_;
-                        hltps_isoMu30_eta2p1_vstar_ = struct_isoMu30_eta2p1_vstar.hltps_;
-                        hltps_relIso1p0Mu17_vstar_  = struct_relIso1p0Mu17_vstar.hltps_;
-                        hltps_relIso1p0Mu20_vstar_  = struct_relIso1p0Mu20_vstar.hltps_;
-                        hltps_relIso1p0Mu5_vstar_   = struct_relIso1p0Mu5_vstar.hltps_;
-
-                        // These are hardcoded to the value in Dima's table:
-                        // http://dmytro.web.cern.ch/dmytro/trigger/triggerEvolution_all.html 
+                        if (BranchGroupSelected(kBabyTriggers2012))
+                        {
+                            // Muons
+                            triggerMatchStruct struct_mu5_vstar             = MatchTriggerClass(mus_p4().at(iLep), mu5_regexp            , 13);
+                            triggerMatchStruct struct_mu8_vstar             = MatchTriggerClass(mus_p4().at(iLep), mu8_regexp            , 13);
+                            triggerMatchStruct struct_mu12_vstar            = MatchTriggerClass(mus_p4().at(iLep), mu12_regexp           , 13);
+                            triggerMatchStruct struct_mu17_vstar            = MatchTriggerClass(mus_p4().at(iLep), mu17_regexp           , 13);
+                            triggerMatchStruct struct_mu15_eta2p1_vstar     = MatchTriggerClass(mus_p4().at(iLep), mu15_eta2p1_regexp    , 13);
+                            triggerMatchStruct struct_mu24_eta2p1_vstar     = MatchTriggerClass(mus_p4().at(iLep), mu24_eta2p1_regexp    , 13);
+                            triggerMatchStruct struct_mu30_eta2p1_vstar     = MatchTriggerClass(mus_p4().at(iLep), mu30_eta2p1_regexp    , 13);
+                            triggerMatchStruct struct_isoMu20_eta2p1_vstar  = MatchTriggerClass(mus_p4().at(iLep), isoMu20_eta2p1_regexp , 13);
+                            triggerMatchStruct struct_isoMu24_eta2p1_vstar  = MatchTriggerClass(mus_p4().at(iLep), isoMu24_eta2p1_regexp , 13);
+                            triggerMatchStruct struct_isoMu30_eta2p1_vstar  = MatchTriggerClass(mus_p4().at(iLep), isoMu30_eta2p1_regexp , 13);
+                            triggerMatchStruct struct_relIso1p0Mu17_vstar   = MatchTriggerClass(mus_p4().at(iLep), relIso1p0Mu17_regexp  , 13);
+                            triggerMatchStruct struct_relIso1p0Mu20_vstar   = MatchTriggerClass(mus_p4().at(iLep), relIso1p0Mu20_regexp  , 13);
+                            triggerMatchStruct struct_relIso1p0Mu5_vstar    = MatchTriggerClass(mus_p4().at(iLep), relIso1p0Mu5_regexp   , 13);
+
+                            mu5_vstar_                  = struct_mu5_vstar.nHLTObjects_;
+                            mu8_vstar_                  = struct_mu8_vstar.nHLTObjects_;
+                            mu12_vstar_                 = struct_mu12_vstar.nHLTObjects_;
+                            mu17_vstar_                 = struct_mu17_vstar.nHLTObjects_;
+                            mu15_eta2p1_vstar_          = struct_mu15_eta2p1_vstar.nHLTObjects_;
+                            mu24_eta2p1_vstar_          = struct_mu24_eta2p1_vstar.nHLTObjects_;
+                            mu30_eta2p1_vstar_          = struct_mu30_eta2p1_vstar.nHLTObjects_;
+                            isoMu20_eta2p1_vstar_       = struct_isoMu20_eta2p1_vstar.nHLTObjects_;
+                            isoMu24_eta2p1_vstar_       = struct_isoMu24_eta2p1_vstar.nHLTObjects_;
+                            isoMu30_eta2p1_vstar_       = struct_isoMu30_eta2p1_vstar.nHLTObjects_;
+                            relIso1p0Mu17_vstar_        = struct_relIso1p0Mu17_vstar.nHLTObjects_;
+                            relIso1p0Mu20_vstar_        = struct_relIso1p0Mu20_vstar.nHLTObjects_;
+                            relIso1p0Mu5_vstar_         = struct_relIso1p0Mu5_vstar.nHLTObjects_;
+
+                            mu5_version_                = struct_mu5_vstar.version_;
+                            mu8_version_                = struct_mu8_vstar.version_;
+                            mu12_version_               = struct_mu12_vstar.version_;
+                            mu17_version_               = struct_mu17_vstar.version_;
+                            mu15_eta2p1_version_        = struct_mu15_eta2p1_vstar.version_;
+                            mu24_eta2p1_version_        = struct_mu24_eta2p1_vstar.version_;
+                            mu30_eta2p1_version_        = struct_mu30_eta2p1_vstar.version_;
+                            isoMu20_eta2p1_version_     = struct_isoMu20_eta2p1_vstar.version_;
+                            isoMu24_eta2p1_version_     = struct_isoMu24_eta2p1_vstar.version_;
+                            isoMu30_eta2p1_version_     = struct_isoMu30_eta2p1_vstar.version_;
+                            relIso1p0Mu17_version_      = struct_relIso1p0Mu17_vstar.version_;
+                            relIso1p0Mu20_version_      = struct_relIso1p0Mu20_vstar.version_;
+                            relIso1p0Mu5_version_       = struct_relIso1p0Mu5_vstar.version_;
+
+                            dr_mu5_vstar_               = struct_mu5_vstar.dR_;
+                            dr_mu8_vstar_               = struct_mu8_vstar.dR_;
+                            dr_mu12_vstar_              = struct_mu12_vstar.dR_;
+                            dr_mu17_vstar_              = struct_mu17_vstar.dR_;
+                            dr_mu15_eta2p1_vstar_       = struct_mu15_eta2p1_vstar.dR_;
+                            dr_mu24_eta2p1_vstar_       = struct_mu24_eta2p1_vstar.dR_;
+                            dr_mu30_eta2p1_vstar_       = struct_mu30_eta2p1_vstar.dR_;
+                            dr_isoMu20_eta2p1_vstar_    = struct_isoMu20_eta2p1_vstar.dR_;
+                            dr_isoMu24_eta2p1_vstar_    = struct_isoMu24_eta2p1_vstar.dR_;
+                            dr_isoMu30_eta2p1_vstar_    = struct_isoMu30_eta2p1_vstar.dR_;
+                            dr_relIso1p0Mu17_vstar_     = struct_relIso1p0Mu17_vstar.dR_;
+                            dr_relIso1p0Mu20_vstar_     = struct_relIso1p0Mu20_vstar.dR_;
+                            dr_relIso1p0Mu5_vstar_      = struct_relIso1p0Mu5_vstar.dR_;
+
+                            hltps_mu5_vstar_            = struct_mu5_vstar.hltps_;
+                            hltps_mu8_vstar_            = struct_mu8_vstar.hltps_;
+                            hltps_mu12_vstar_           = struct_mu12_vstar.hltps_;
+                            hltps_mu17_vstar_           = struct_mu17_vstar.hltps_;
+                            hltps_mu15_eta2p1_vstar_    = struct_mu15_eta2p1_vstar.hltps_;
+                            hltps_mu24_eta2p1_vstar_    = struct_mu24_eta2p1_vstar.hltps_;
+                            hltps_mu30_eta2p1_vstar_    = struct_mu30_eta2p1_vstar.hltps_;
+                            hltps_isoMu20_eta2p1_vstar_ = struct_isoMu20_eta2p1_vstar.hltps_;
+                            hltps_isoMu24_eta2p1_vstar_ = struct_isoMu24_eta2p1_vstar.hltps_;
+                            hltps_isoMu30_eta2p1_vstar_ = struct_isoMu30_eta2p1_vstar.hltps_;
+                            hltps_relIso1p0Mu17_vstar_  = struct_relIso1p0Mu17_vstar.hltps_;
+                            hltps_relIso1p0Mu20_vstar_  = struct_relIso1p0Mu20_vstar.hltps_;
+                            hltps_relIso1p0Mu5_vstar_   = struct_relIso1p0Mu5_vstar.hltps_;
+
+                            // These are hardcoded to the value in Dima's table:
+                            // http://dmytro.web.cern.ch/dmytro/trigger/triggerEvolution_all.html 
 #ifndef __CMS2_SLIM__
-                        l1ps_mu5_vstar_            = L1_prescale("L1_SingleMu3"         );
-                        l1ps_mu8_vstar_            = L1_prescale("L1_SingleMu3"         );
-                        l1ps_mu12_vstar_           = L1_prescale("L1_SingleMu7"         );
-                        l1ps_mu17_vstar_           = L1_prescale("L1_SingleMu12"        );
-                        l1ps_mu15_eta2p1_vstar_    = L1_prescale("L1_SingleMu7"         );
-                        l1ps_mu24_eta2p1_vstar_    = L1_prescale("L1_SingleMu16_Eta2p1" );
-                        l1ps_mu30_eta2p1_vstar_    = L1_prescale("L1_SingleMu16_Eta2p1" );
-                        l1ps_isoMu20_eta2p1_vstar_ = L1_prescale("L1_SingleMu16_Eta2p1" );
-                        l1ps_isoMu24_eta2p1_vstar_ = L1_prescale("L1_SingleMu16_Eta2p1" );
-                        l1ps_isoMu30_eta2p1_vstar_ = L1_prescale("L1_SingleMu16_Eta2p1" );
-                        l1ps_relIso1p0Mu17_vstar_  = L1_prescale("L1_SingleMu12"        );
-                        l1ps_relIso1p0Mu5_vstar_   = L1_prescale("L1_SingleMu3"         );
+                            l1ps_mu5_vstar_            = L1_prescale("L1_SingleMu3"         );
+                            l1ps_mu8_vstar_            = L1_prescale("L1_SingleMu3"         );
+                            l1ps_mu12_vstar_           = L1_prescale("L1_SingleMu7"         );
+                            l1ps_mu17_vstar_           = L1_prescale("L1_SingleMu12"        );
+                            l1ps_mu15_eta2p1_vstar_    = L1_prescale("L1_SingleMu7"         );
+                            l1ps_mu24_eta2p1_vstar_    = L1_prescale("L1_SingleMu16_Eta2p1" );
+                            l1ps_mu30_eta2p1_vstar_    = L1_prescale("L1_SingleMu16_Eta2p1" );
+                            l1ps_isoMu20_eta2p1_vstar_ = L1_prescale("L1_SingleMu16_Eta2p1" );
+                            l1ps_isoMu24_eta2p1_vstar_ = L1_prescale("L1_SingleMu16_Eta2p1" );
+                            l1ps_isoMu30_eta2p1_vstar_ = L1_prescale("L1_SingleMu16_Eta2p1" );
+                            l1ps_relIso1p0Mu17_vstar_  = L1_prescale("L1_SingleMu12"        );
+                            l1ps_relIso1p0Mu5_vstar_   = L1_prescale("L1_SingleMu3"         );
 #endif
+                        }
 
 
                         ///////////////////////  
@@ -3640,41 +3242,44 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         // 2011 Triggers     //
                         ///////////////////////
 
-                        // Muons
-                        triggerMatchStruct struct_mu3_vstar       = MatchTriggerClass(mus_p4().at(iLep), mu3_regexp      , 13);
-                        triggerMatchStruct struct_mu15_vstar      = MatchTriggerClass(mus_p4().at(iLep), mu15_regexp     , 13);
-                        triggerMatchStruct struct_mu20_vstar      = MatchTriggerClass(mus_p4().at(iLep), mu20_regexp     , 13);
-                        triggerMatchStruct struct_mu24_vstar      = MatchTriggerClass(mus_p4().at(iLep), mu24_regexp     , 13);
-                        triggerMatchStruct struct_mu30_vstar      = MatchTriggerClass(mus_p4().at(iLep), mu30_regexp     , 13);
-                        triggerMatchStruct struct_mu8_Jet40_vstar = MatchTriggerClass(mus_p4().at(iLep), mu8_Jet40_regexp, 13);
-
-                        mu3_vstar_          = struct_mu3_vstar.nHLTObjects_;
-                        mu15_vstar_         = struct_mu15_vstar.nHLTObjects_;
-                        mu20_vstar_         = struct_mu20_vstar.nHLTObjects_;
-                        mu24_vstar_         = struct_mu24_vstar.nHLTObjects_;
-                        mu30_vstar_         = struct_mu30_vstar.nHLTObjects_;
-                        mu8_Jet40_vstar_    = struct_mu8_Jet40_vstar.nHLTObjects_;
-
-                        mu3_version_        = struct_mu3_vstar.version_;
-                        mu15_version_       = struct_mu15_vstar.version_;
-                        mu20_version_       = struct_mu20_vstar.version_;
-                        mu24_version_       = struct_mu24_vstar.version_;
-                        mu30_version_       = struct_mu30_vstar.version_;
-                        mu8_Jet40_version_  = struct_mu8_Jet40_vstar.version_;
-
-                        dr_mu3_vstar_       = struct_mu3_vstar.dR_;
-                        dr_mu15_vstar_      = struct_mu15_vstar.dR_;
-                        dr_mu20_vstar_      = struct_mu20_vstar.dR_;
-                        dr_mu24_vstar_      = struct_mu24_vstar.dR_;
-                        dr_mu30_vstar_      = struct_mu30_vstar.dR_;
-                        dr_mu8_Jet40_vstar_ = struct_mu8_Jet40_vstar.dR_;
-
-                        hltps_mu3_vstar_       = struct_mu3_vstar.hltps_;
-                        hltps_mu15_vstar_      = struct_mu15_vstar.hltps_;
-                        hltps_mu20_vstar_      = struct_mu20_vstar.hltps_;
-                        hltps_mu24_vstar_      = struct_mu24_vstar.hltps_;
-                        hltps_mu30_vstar_      = struct_mu30_vstar.hltps_;
-                        hltps_mu8_Jet40_vstar_ = struct_mu8_Jet40_vstar.hltps_;
+                        if (BranchGroupSelected(kBabyTriggers2011))
+                        {
+                            // Muons
+                            triggerMatchStruct struct_mu3_vstar       = MatchTriggerClass(mus_p4().at(iLep), mu3_regexp      , 13);
+                            triggerMatchStruct struct_mu15_vstar      = MatchTriggerClass(mus_p4().at(iLep), mu15_regexp     , 13);
+                            triggerMatchStruct struct_mu20_vstar      = MatchTriggerClass(mus_p4().at(iLep), mu20_regexp     , 13);
+                            triggerMatchStruct struct_mu24_vstar      = MatchTriggerClass(mus_p4().at(iLep), mu24_regexp     , 13);
+                            triggerMatchStruct struct_mu30_vstar      = MatchTriggerClass(mus_p4().at(iLep), mu30_regexp     , 13);
+                            triggerMatchStruct struct_mu8_Jet40_vstar = MatchTriggerClass(mus_p4().at(iLep), mu8_Jet40_regexp, 13);
+
+                            mu3_vstar_          = struct_mu3_vstar.nHLTObjects_;
+                            mu15_vstar_         = struct_mu15_vstar.nHLTObjects_;
+                            mu20_vstar_         = struct_mu20_vstar.nHLTObjects_;
+                            mu24_vstar_         = struct_mu24_vstar.nHLTObjects_;
+                            mu30_vstar_         = struct_mu30_vstar.nHLTObjects_;
+                            mu8_Jet40_vstar_    = struct_mu8_Jet40_vstar.nHLTObjects_;
+
+                            mu3_version_        = struct_mu3_vstar.version_;
+                            mu15_version_       = struct_mu15_vstar.version_;
+                            mu20_version_       = struct_mu20_vstar.version_;
+                            mu24_version_       = struct_mu24_vstar.version_;
+                            mu30_version_       = struct_mu30_vstar.version_;
+                            mu8_Jet40_version_  = struct_mu8_Jet40_vstar.version_;
+
+                            dr_mu3_vstar_       = struct_mu3_vstar.dR_;
+                            dr_mu15_vstar_      = struct_mu15_vstar.dR_;
+                            dr_mu20_vstar_      = struct_mu20_vstar.dR_;
+                            dr_mu24_vstar_      = struct_mu24_vstar.dR_;
+                            dr_mu30_vstar_      = struct_mu30_vstar.dR_;
+                            dr_mu8_Jet40_vstar_ = struct_mu8_Jet40_vstar.dR_;
+
+                            hltps_mu3_vstar_       = struct_mu3_vstar.hltps_;
+                            hltps_mu15_vstar_      = struct_mu15_vstar.hltps_;
+                            hltps_mu20_vstar_      = struct_mu20_vstar.hltps_;
+                            hltps_mu24_vstar_      = struct_mu24_vstar.hltps_;
+                            hltps_mu30_vstar_      = struct_mu30_vstar.hltps_;
+                            hltps_mu8_Jet40_vstar_ = struct_mu8_Jet40_vstar.hltps_;
+                        }
 
                         ///////////////////////  
                         // End 2011 Triggers //
@@ -3707,200 +3312,10 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         //                     }
                         // #endif
 
-                        // PF Jets
-                        // Find the highest Pt pfjet separated by at least dRcut from this lepton and fill the pfjet Pt
-                        ptpfj1_       = -999.0;
-                        ptpfj1_b2b_   = -999.0;
-                        dphipfj1_b2b_ = -999.0;
-                        npfj1_        = 0;
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            double dr = ROOT::Math::VectorUtil::DeltaR( mus_p4().at(iLep), pfjets_p4().at(iJet) );
-                            if( dr > deltaRCut && pfjets_p4().at(iJet).pt() > 10 ) npfj1_++;
-                            if ( dr > deltaRCut && pfjets_p4().at(iJet).pt() > ptpfj1_ ){
-                                ptpfj1_ = pfjets_p4().at(iJet).pt();
-
-                                // back to back in phi
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( mus_p4().at(iLep), pfjets_p4().at(iJet) ) );
-                                if( dphi > deltaPhiCut && pfjets_p4().at(iJet).pt() > ptpfj1_b2b_ ){        
-                                    ptpfj1_b2b_   = pfjets_p4().at(iJet).pt();
-                                    dphipfj1_b2b_ = dphi;
-                                }
-                            }
-                        }
-
-                        // L2L3 PF Jets
-                        // Find the highest Pt PF corrected jet separated by at least dRcut from this lepton and fill the jet Pt
-                        ptpfcj1_       = -999.0;
-                        ptpfcj1_b2b_   = -999.0;
-                        dphipfcj1_b2b_ = -999.0;
-                        npfcj1_        = 0;
-                        btagpfc_       = false;
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            // JetID
-                            if ( !passesPFJetID(iJet)) continue;
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = jetCorrection(jp4, jet_pf_L2L3corrector);
-                            //float jet_cor = pfjets_corL2L3().at(iJet);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            if (jp4cor.pt() > 15 && pfjets_combinedSecondaryVertexBJetTag().at(iJet) > 0.679 ) btagpfc_ = true;
-                            double dr = ROOT::Math::VectorUtil::DeltaR( mus_p4().at(iLep), jp4cor );
-                            if( dr > deltaRCut && jp4cor.pt() > 10 ) npfcj1_++;
-                            if ( dr > deltaRCut && jp4cor.pt() > ptpfcj1_ ){
-                                ptpfcj1_ = jp4cor.pt();
-
-                                // back to back in phi
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( mus_p4().at(iLep), jp4cor ) );
-                                if( dphi > deltaPhiCut && jp4cor.pt() > ptpfcj1_b2b_ ){
-                                    ptpfcj1_b2b_   = jp4cor.pt();
-                                    dphipfcj1_b2b_ = dphi;
-                                }
-                            }
-                        }
-
-                        // L1FastL2L3 PF Jets
-                        // Find the highest Pt PF corrected jet separated by at least dRcut from this lepton and fill the jet Pt
-                        emfpfcL1Fj1_      = -999.0;
-                        ptpfcL1Fj1_       = -999.0;
-                        dphipfcL1Fj1_     = -999.0;
-                        ptpfcL1Fj1_b2b_   = -999.0;
-                        dphipfcL1Fj1_b2b_ = -999.0;
-                        npfcL1Fj1_        = 0;
-                        npfc30L1Fj1_      = 0;
-                        npfc40L1Fj1_      = 0;
-                        nbpfc40L1Fj1_     = 0;
-                        npfc50L1Fj1_eth_  = 0;
-                        npfc65L1Fj1_eth_  = 0;
-                        btagpfcL1F_       = false;
-                        rho_ = cms2.evt_rho();
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            // JetID
-                            if ( !passesPFJetID(iJet)) continue;
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = cms2.pfjets_corL1FastL2L3().at(iJet);
-                            //jet_pf_L1FastJetL2L3_corrector->setRho(cms2.evt_ww_rho_vor());
-                            //jet_pf_L1FastJetL2L3_corrector->setJetA(cms2.pfjets_area().at(iJet));
-                            //jet_pf_L1FastJetL2L3_corrector->setJetPt(cms2.pfjets_p4().at(iJet).pt());
-                            //jet_pf_L1FastJetL2L3_corrector->setJetEta(cms2.pfjets_p4().at(iJet).eta()); 
-                            //float jet_cor = jetCorrection(jp4, jet_pf_L1FastJetL2L3_corrector);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            if (jp4cor.pt() > 15 && pfjets_combinedSecondaryVertexBJetTag().at(iJet) > 0.679 ) btagpfcL1F_ = true;
-                            double dr = ROOT::Math::VectorUtil::DeltaR( mus_p4().at(iLep), jp4cor );
-                            if( dr > deltaRCut && jp4cor.pt() > 10 ) npfcL1Fj1_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 30 ) npfc30L1Fj1_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 40 ) npfc40L1Fj1_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 40 && pfjets_combinedSecondaryVertexBJetTag().at(iJet) > 0.679) nbpfc40L1Fj1_++;
-                            if( dr > 0.4       && jp4cor.pt() > 50 ) npfc50L1Fj1_eth_++;
-                            if( dr > 0.4       && jp4cor.pt() > 65 ) npfc65L1Fj1_eth_++;
-                            if ( dr > deltaRCut && jp4cor.pt() > ptpfcL1Fj1_ ){
-                                emfpfcL1Fj1_ = (cms2.pfjets_chargedEmE().at(iJet) + cms2.pfjets_neutralEmE().at(iJet)) / pfjets_p4().at(iJet).E();
-                                ptpfcL1Fj1_ = jp4cor.pt();
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( mus_p4().at(iLep), jp4cor ) );
-                                dphipfcL1Fj1_ = dphi;
-
-                                // back to back in phi
-                                if( dphi > deltaPhiCut && jp4cor.pt() > ptpfcL1Fj1_b2b_ ){
-                                    ptpfcL1Fj1_b2b_   = jp4cor.pt();
-                                    dphipfcL1Fj1_b2b_ = dphi;
-                                }
-                            }
-                        }
-
-                        // L1FastL2L3Residual PF Jets
-                        // Find the highest Pt PF corrected jet separated by at least dRcut from this lepton and fill the jet Pt
-                        emfpfcL1Fj1res_      = -999.0;
-                        ptpfcL1Fj1res_       = -999.0;
-                        dphipfcL1Fj1res_      = -999.0;
-                        ptpfcL1Fj1res_b2b_   = -999.0;
-                        dphipfcL1Fj1res_b2b_ = -999.0;
-                        npfcL1Fj1res_        = 0;
-                        npfc30L1Fj1res_      = 0;
-                        npfc40L1Fj1res_      = 0;
-                        nbpfc40L1Fj1res_     = 0;
-                        npfc50L1Fj1res_eth_  = 0;
-                        npfc65L1Fj1res_eth_  = 0;
-                        btagpfcL1Fres_       = false;
-                        rho_ = cms2.evt_rho();
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            // JetID
-                            if ( !passesPFJetID(iJet)) continue;
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = cms2.pfjets_corL1FastL2L3residual().at(iJet);
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setRho(cms2.evt_ww_rho_vor());
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetA(cms2.pfjets_area().at(iJet));
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetPt(cms2.pfjets_p4().at(iJet).pt());
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetEta(cms2.pfjets_p4().at(iJet).eta()); 
-                            //float jet_cor = jetCorrection(jp4, jet_pf_L1FastJetL2L3Residual_corrector);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            if (jp4cor.pt() > 15 && pfjets_combinedSecondaryVertexBJetTag().at(iJet) > 0.679 ) btagpfcL1Fres_ = true;
-                            double dr = ROOT::Math::VectorUtil::DeltaR( mus_p4().at(iLep), jp4cor );
-                            if( dr > deltaRCut && jp4cor.pt() > 10 ) npfcL1Fj1res_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 30 ) npfc30L1Fj1res_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 40 ) npfc40L1Fj1res_++;
-                            if( dr > deltaRCut && jp4cor.pt() > 40 && pfjets_combinedSecondaryVertexBJetTag().at(iJet) > 0.679) nbpfc40L1Fj1res_++;
-                            if( dr > 0.4       && jp4cor.pt() > 50 ) npfc50L1Fj1res_eth_++;
-                            if( dr > 0.4       && jp4cor.pt() > 65 ) npfc65L1Fj1res_eth_++;
-                            if ( dr > deltaRCut && jp4cor.pt() > ptpfcL1Fj1res_ ){
-                                emfpfcL1Fj1res_ = (cms2.pfjets_chargedEmE().at(iJet) + cms2.pfjets_neutralEmE().at(iJet)) / pfjets_p4().at(iJet).E();
-                                ptpfcL1Fj1res_ = jp4cor.pt();
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( mus_p4().at(iLep), jp4cor ) );
-                                dphipfcL1Fj1res_ = dphi;
-
-                                // back to back in phi
-                                if( dphi > deltaPhiCut && jp4cor.pt() > ptpfcL1Fj1res_b2b_ ){
-                                    ptpfcL1Fj1res_b2b_   = jp4cor.pt();
-                                    dphipfcL1Fj1res_b2b_ = dphi;
-                                }
-                            }
-                        }
-
-                        //***  Doing B-tagging correctly ***
-                        // B-tagged L1FastL2L3 PF Jets
-                        // Find the highest Pt B-tagged PF L1FastL2L3 corrected jet separated by at least dRcut from this lepton and fill the jet Pt
-                        ptbtagpfcL1Fj1_       = -999.0;
-                        dphibtagpfcL1Fj1_       = -999.0;
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            if ( !passesPFJetID(iJet)) continue;
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = cms2.pfjets_corL1FastL2L3().at(iJet);
-                            //jet_pf_L1FastJetL2L3_corrector->setRho(cms2.evt_ww_rho_vor());
-                            //jet_pf_L1FastJetL2L3_corrector->setJetA(cms2.pfjets_area().at(iJet));
-                            //jet_pf_L1FastJetL2L3_corrector->setJetPt(cms2.pfjets_p4().at(iJet).pt());
-                            //jet_pf_L1FastJetL2L3_corrector->setJetEta(cms2.pfjets_p4().at(iJet).eta()); 
-                            //float jet_cor = jetCorrection(jp4, jet_pf_L1FastJetL2L3_corrector);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            if (pfjets_combinedSecondaryVertexBJetTag().at(iJet) < 0.679 ) continue;
-                            double dr = ROOT::Math::VectorUtil::DeltaR( mus_p4().at(iLep), jp4cor );
-                            if ( dr > deltaRCut && jp4cor.pt() > ptbtagpfcL1Fj1_ ){
-                                ptbtagpfcL1Fj1_ = jp4cor.pt();
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( mus_p4().at(iLep), jp4cor ) );
-                                dphibtagpfcL1Fj1_ = dphi; 
-                            }
-                        }
-
-                        //***  Doing B-tagging correctly ***
-                        // B-tagged L1FastL2L3Residual PF Jets
-                        // Find the highest Pt B-tagged PF L1FastL2L3Residual corrected jet separated by at least dRcut from this lepton and fill the jet Pt
-                        ptbtagpfcL1Fj1res_       = -999.0;
-                        dphibtagpfcL1Fj1res_     = -999.0;
-                        for (unsigned int iJet = 0; iJet < pfjets_p4().size(); iJet++) {
-                            if ( !passesPFJetID(iJet)) continue;
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            float jet_cor = cms2.pfjets_corL1FastL2L3residual().at(iJet);
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setRho(cms2.evt_ww_rho_vor());
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetA(cms2.pfjets_area().at(iJet));
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetPt(cms2.pfjets_p4().at(iJet).pt());
-                            //jet_pf_L1FastJetL2L3Residual_corrector->setJetEta(cms2.pfjets_p4().at(iJet).eta()); 
-                            //float jet_cor = jetCorrection(jp4, jet_pf_L1FastJetL2L3Residual_corrector);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            if (pfjets_combinedSecondaryVertexBJetTag().at(iJet) < 0.679 ) continue;
-                            double dr = ROOT::Math::VectorUtil::DeltaR( mus_p4().at(iLep), jp4cor );
-                            if ( dr > deltaRCut && jp4cor.pt() > ptbtagpfcL1Fj1res_ ){
-                                ptbtagpfcL1Fj1res_ = jp4cor.pt();
-                                float dphi = fabs( ROOT::Math::VectorUtil::DeltaPhi( mus_p4().at(iLep), jp4cor ) );
-                                dphibtagpfcL1Fj1res_ = dphi; 
-                            }
-                        }
-
+                        // PF Jets at all correction levels (raw, L2L3, L1FastL2L3, L1FastL2L3Residual and b-tagged)
+                        // Find the highest Pt jets separated by at least dRcut from this lepton and count the jets
+                        if (BranchGroupSelected(kBabyJets))
+                            FillJetVariables(jetCache, mus_p4().at(iLep), deltaRCut, deltaPhiCut, jetCache.btag_level);
 
                         //////////////
                         // End Jets //
@@ -3924,24 +3339,7 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
                         // #endif
 
                         // The btag information for pfjets
-                        nbpfcjet_ = this_nbpfjet;
-                        dRbpfcNear_ = 99.;
-                        dRbpfcFar_  = -99.;
-                        //FactorizedJetCorrector* jet_pf_corrector = evt_isRealData() ? jet_pf_L1FastJetL2L3Residual_corrector : jet_pf_L1FastJetL2L3_corrector; 
-                        for (int ii=0; ii<nbpfcjet_; ii++) {
-                            unsigned int iJet = bpfindex.at(ii);
-                            LorentzVector jp4 = pfjets_p4().at(iJet);
-                            //jet_pf_corrector->setRho(cms2.evt_ww_rho_vor());
-                            //jet_pf_corrector->setJetA(cms2.pfjets_area().at(iJet));
-                            //jet_pf_corrector->setJetPt(cms2.pfjets_p4().at(iJet).pt());
-                            //jet_pf_corrector->setJetEta(cms2.pfjets_p4().at(iJet).eta()); 
-                            //float jet_cor = jetCorrection(jp4, jet_pf_corrector);
-                            float jet_cor = evt_isRealData() ? cms2.pfjets_corL1FastL2L3residual().at(iJet) : cms2.pfjets_corL1FastL2L3().at(iJet);
-                            LorentzVector jp4cor = jp4 * jet_cor;
-                            float dr = ROOT::Math::VectorUtil::DeltaR( mus_p4().at(iLep), jp4cor);
-                            if (dr < dRbpfcNear_) dRbpfcNear_ = dr;
-                            if (dr > dRbpfcFar_)   dRbpfcFar_  = dr;
-                        }
+                        // filled with the jets (see FillJetVariables)
 
                         ///////////////////
                         // End B Tagging //
@@ -3960,10 +3358,22 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
             f->Close();
             //delete f;
 
+            // checkpoint: record the completed file and flush the ledger and the baby
+            // (the line goes first, a resume skips it if the baby did not make it)
+            if (journal && !finish_looping)
+            {
+                journalFile << "file " << (ifile - 1) << " " << nEventsTotal << " " << babyTree_->GetEntries() << " " << filename << endl;
+                babyFile_->cd();
+                ledgerTree_->AutoSave("SaveSelf");
+                WriteBabyMetadata();
+                babyTree_->AutoSave("SaveSelf");
+            }
+
         }  // closes loop over files
 
         std::cout << "nEventTotal = " << nEventsTotal << endl;
         std::cout << "nEventChain = " << nEventsChain << endl;
+        already_seen.PrintSummary(std::cout);
 
         bmark.Stop("benchmark");
         cout << endl;
@@ -3975,14 +3385,386 @@ void myBabyMaker::ScanChain(TChain* chain, const char *babyFilename, int eormu,
         cout << "Real Time: " << Form("%.01f", bmark.GetRealTime("benchmark")) << endl;
         cout << endl;
 
+        trigger_study.Close();
+
+        // the ledger is only needed to resume
+        if (journal)
+        {
+            delete ledgerTree_;
+            ledgerTree_ = NULL;
+            babyFile_->Delete("ledger;*");
+        }
         CloseBabyNtuple();
-        return;
+
+        // the job is complete: a rerun starts from scratch
+        if (journal)
+        {
+            journalFile.close();
+            remove(Form("%s.journal", babyFilename));
+        }
+        return true;
 
     }
     catch (std::exception& e)
     {
         cout << e.what() << endl;
     }
+    return false;
 
 } // closes myLooper function  
 
+//-----------------------------------
+// File-parallel version of ScanChain.
+// The files of the chain are split into nWorkers_ contiguous blocks and
+// each block is run through the serial ScanChain in a forked process
+// (the CMS2 reader is a global, so the workers cannot be threads).
+// Each worker writes its own baby plus a ledger of the events it accepted.
+// The outputs are then merged in chain order, which is where the duplicate
+// rejection and the SetNumEvents limit are applied across all workers.
+//-----------------------------------
+bool myBabyMaker::ScanChainParallel(TChain* chain, const char *babyFilename, int eormu, bool applyFOfilter, const std::string& jetcorrPath)
+{
+    try
+    {
+        TObjArray *listOfFiles = chain->GetListOfFiles();
+        const int nFiles   = listOfFiles->GetEntries();
+        const int nWorkers = std::min(nWorkers_, nFiles);
+
+        std::cout << "running on " << nFiles << " files with " << nWorkers << " worker processes..." << std::endl;
+
+        // the workers would all append to the same triggerStudy/ files
+        // (both are turned off in the workers only, the settings are kept for later runs)
+        if (triggerStudy_)
+            std::cout << "[FR baby maker]: trigger study is not supported with several workers, turning it off" << std::endl;
+
+        // the worker outputs are temporary, so there is nothing to resume from
+        if (journal_)
+            std::cout << "[FR baby maker]: the journal is not supported with several workers, turning it off" << std::endl;
+
+        TBenchmark bmark;
+        bmark.Start("benchmark");
+
+        std::vector<std::string> workerFileNames;
+        std::vector<pid_t> workerPids;
+        for (int iworker = 0; iworker < nWorkers; iworker++)
+        {
+            workerFileNames.push_back(Form("%s.worker%d", babyFilename, iworker));
+
+            // flush before forking so that buffered output is not written twice
+            std::cout.flush();
+            fflush(stdout);
+
+            pid_t pid = fork();
+            if (pid < 0)
+            {
+                throw std::runtime_error(Form("[FR baby maker]: ScanChainParallel - could not fork worker %d", iworker));
+            }
+            if (pid == 0)
+            {
+                // worker: run the serial looper on a contiguous block of files
+                TChain workerChain(chain->GetName());
+                for (int ifile = iworker * nFiles / nWorkers; ifile < (iworker + 1) * nFiles / nWorkers; ifile++)
+                {
+                    workerChain.Add(listOfFiles->At(ifile)->GetTitle());
+                }
+                nWorkers_     = 1;
+                writeLedger_  = true;
+                triggerStudy_ = false;
+                journal_      = false;
+
+                // the merge fills the fake rates from the worker rows, after removing the duplicates
+                writeBaby_ = true;
+                fakeRates_.clear();
+
+                // the ledger rows refer to a single file: the merge splits the output
+                maxOutputBytes_   = 0;
+                maxOutputEntries_ = 0;
+                if (!duplicateSpillFile_.empty())
+                    duplicateSpillFile_ += Form(".worker%d", iworker);
+                const bool workerOK = ScanChain(&workerChain, workerFileNames.back().c_str(), eormu, applyFOfilter, jetcorrPath);
+
+                // _exit skips the stdio buffers, and a failed worker must not be merged
+                std::cout.flush();
+                fflush(stdout);
+                _exit(workerOK ? 0 : 1);
+            }
+            workerPids.push_back(pid);
+        }
+
+        // wait for all the workers
+        bool workersOK = true;
+        for (unsigned int iworker = 0; iworker < workerPids.size(); iworker++)
+        {
+            int status = 0;
+            waitpid(workerPids.at(iworker), &status, 0);
+            if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+            {
+                cout << "\t! ERROR: worker " << iworker << " did not finish cleanly." << endl;
+                workersOK = false;
+            }
+        }
+        if (!workersOK)
+        {
+            throw std::runtime_error("[FR baby maker]: ScanChainParallel - at least one worker failed; worker outputs are kept");
+        }
+
+        MergeWorkerOutput(babyFilename, workerFileNames);
+        already_seen.PrintSummary(std::cout);
+
+        bmark.Stop("benchmark");
+        cout << endl;
+        cout << "------------------------------" << endl;
+        cout << "CPU  Time: " << Form("%.01f", bmark.GetCpuTime("benchmark" )) << endl;
+        cout << "Real Time: " << Form("%.01f", bmark.GetRealTime("benchmark")) << endl;
+        cout << endl;
+        return true;
+    }
+    catch (std::exception& e)
+    {
+        cout << e.what() << endl;
+    }
+    return false;
+}
+
+// Merge the worker babies into babyFilename in chain order.
+// The ledger of each worker lists its accepted events in order together with
+// the first baby row of each event, so the rows of an event are the range
+// [first_row, next first_row).  Events are dropped here if they are duplicates
+// of an event from an earlier worker or if they are beyond SetNumEvents.
+void myBabyMaker::MergeWorkerOutput(const char *babyFilename, const std::vector<std::string>& workerFileNames)
+{
+    already_seen.Clear();
+    already_seen.SetSpillFile(duplicateSpillFile_, duplicateMaxMemoryMB_);
+    MakeBabyNtuple(babyFilename);
+
+    const bool hasLimit = (nEvents_ != -1);
+    unsigned int nEventsTotal = 0;
+    bool finish_looping = false;
+
+    for (unsigned int iworker = 0; iworker < workerFileNames.size(); iworker++)
+    {
+        TFile* workerFile   = TFile::Open(workerFileNames.at(iworker).c_str());
+        TTree* workerTree   = workerFile ? dynamic_cast<TTree*>(workerFile->Get("tree"))   : NULL;
+        TTree* workerLedger = workerFile ? dynamic_cast<TTree*>(workerFile->Get("ledger")) : NULL;
+        if (!workerTree || !workerLedger)
+        {
+            throw std::runtime_error(Form("[FR baby maker]: MergeWorkerOutput - %s is missing the baby or the ledger", workerFileNames.at(iworker).c_str()));
+        }
+
+        // read the worker rows straight into the baby variables
+        babyTree_->CopyAddresses(workerTree);
+
+        // the name indices of the worker become indices in the merged tables
+        std::vector<Int_t> datasetIndex, fileIndex;
+        const std::vector<std::string> workerDatasets   = baby_metadata::ReadNames(workerFile, baby_metadata::kDatasets );
+        const std::vector<std::string> workerInputFiles = baby_metadata::ReadNames(workerFile, baby_metadata::kFilenames);
+        ReadQuantizationErrors(workerFile);
+        for (unsigned int i = 0; i < workerDatasets.size(); i++)
+            datasetIndex.push_back(NameIndex(datasetNames_, workerDatasets.at(i).c_str()));
+        for (unsigned int i = 0; i < workerInputFiles.size(); i++)
+            fileIndex.push_back(NameIndex(fileNames_, workerInputFiles.at(i).c_str()));
+
+        Int_t    run = -1, ls = -1;
+        UInt_t   evt = 0;
+        Bool_t   is_real_data = false;
+        Long64_t first_row = 0;
+        workerLedger->SetBranchAddress("run"         , &run         );
+        workerLedger->SetBranchAddress("ls"          , &ls          );
+        workerLedger->SetBranchAddress("evt"         , &evt         );
+        workerLedger->SetBranchAddress("is_real_data", &is_real_data);
+        workerLedger->SetBranchAddress("first_row"   , &first_row   );
+
+        const Long64_t nRows   = workerTree->GetEntries();
+        const Long64_t nLedger = workerLedger->GetEntries();
+        Long64_t row    = 0;
+        bool keepEvent  = false;
+        for (Long64_t ievt = 0; ievt <= nLedger; ievt++)
+        {
+            // rows of the previous event end where this one starts
+            Long64_t end_row = nRows;
+            if (ievt < nLedger && !finish_looping)
+            {
+                workerLedger->GetEntry(ievt);
+                end_row = first_row;
+            }
+            for (; row < end_row; row++)
+            {
+                if (!keepEvent)
+                    continue;
+                workerTree->GetEntry(row);
+                if (dataset_idx_ >= 0 && dataset_idx_ < static_cast<Int_t>(datasetIndex.size()))
+                    dataset_idx_ = datasetIndex.at(dataset_idx_);
+                if (filename_idx_ >= 0 && filename_idx_ < static_cast<Int_t>(fileIndex.size()))
+                    filename_idx_ = fileIndex.at(filename_idx_);
+                if (!fakeRates_.empty())
+                    UnpackBabyRow();
+                FillBabyRow();  // the selection words and trigger block are already filled
+            }
+            CheckOutputRollover();
+            if (ievt == nLedger || finish_looping)
+                break;
+
+            keepEvent = false;
+            if (hasLimit && nEventsTotal >= static_cast<unsigned int>(nEvents_))
+            {
+                finish_looping = true;
+                continue;
+            }
+            if (is_real_data)
+            {
+                DorkyEventIdentifier id = {static_cast<unsigned long>(run), evt, static_cast<unsigned long>(ls)};
+                if (is_duplicate(id))
+                {
+                    cout << "\t! ERROR: found duplicate." << endl;
+                    continue;
+                }
+            }
+            keepEvent = true;
+            ++nEventsTotal;
+        }
+
+        babyTree_->CopyAddresses(workerTree, /*undo=*/true);
+        workerFile->Close();
+        delete workerFile;
+        if (finish_looping)
+            break;
+    }
+
+    std::cout << "nEventTotal = " << nEventsTotal << endl;
+    cout << nEventsTotal << " Events Processed" << endl;
+
+    CloseBabyNtuple();
+
+    // the worker outputs are no longer needed
+    for (unsigned int iworker = 0; iworker < workerFileNames.size(); iworker++)
+    {
+        gSystem->Unlink(workerFileNames.at(iworker).c_str());
+    }
+}
+
+// Book the baby and pick up the part of an interrupted job recorded in
+// <babyFilename>.journal.  The journal has one line per completed input file:
+//     file <index in chain> <nEventsTotal> <baby entries> <file name>
+// written right before the ledger and the baby are flushed with AutoSave
+// (the trees are saved at these checkpoints only).  The baby in the file is
+// continued from the last line it has all the entries of, and the data events
+// of the ledger, with or without rows, go back into the duplicate event filter.
+void myBabyMaker::ResumeFromJournal(const char *babyFilename, TObjArray *listOfFiles, unsigned int &nCompletedFiles, unsigned int &nEventsTotal)
+{
+    nCompletedFiles = 0;
+    nEventsTotal    = 0;
+
+    const std::string journalName = Form("%s.journal", babyFilename);
+    std::vector<std::string>  lines;
+    std::vector<unsigned int> lineEvents;
+    std::vector<Long64_t>     lineEntries;
+    std::ifstream journal(journalName.c_str());
+    std::string line;
+    while (std::getline(journal, line))
+    {
+        std::istringstream fields(line);
+        std::string tag, filename;
+        unsigned int index = 0, nevents = 0;
+        Long64_t entries = 0;
+        if (!(fields >> tag) || tag != "file")
+            continue;
+        if (!(fields >> index >> nevents >> entries >> filename))
+            throw std::logic_error(Form("[FR baby maker]: ResumeFromJournal - cannot parse '%s' in %s", line.c_str(), journalName.c_str()));
+
+        // the chain has to be the same as for the interrupted job
+        if (index != lines.size() || index >= static_cast<unsigned int>(listOfFiles->GetEntries()) || filename != listOfFiles->At(index)->GetTitle())
+            throw std::logic_error(Form("[FR baby maker]: ResumeFromJournal - %s does not match the chain (remove it to start over)", journalName.c_str()));
+
+        lines.push_back(line);
+        lineEvents.push_back(nevents);
+        lineEntries.push_back(entries);
+    }
+    journal.close();
+
+    if (lines.empty())
+    {
+        remove(journalName.c_str());
+        MakeBabyNtuple(babyFilename);
+        BookLedger();
+    }
+    else
+    {
+        MakeBabyNtuple(babyFilename, "UPDATE");
+        TKey* treeKey   = babyFile_->GetKey("tree");
+        TKey* ledgerKey = babyFile_->GetKey("ledger");
+        TTree* oldTree   = treeKey   ? dynamic_cast<TTree*>(treeKey->ReadObj())   : NULL;
+        TTree* oldLedger = ledgerKey ? dynamic_cast<TTree*>(ledgerKey->ReadObj()) : NULL;
+        if (!oldTree || !oldLedger)
+            throw std::runtime_error(Form("[FR baby maker]: ResumeFromJournal - %s has no baby or ledger to resume from (remove %s to start over)", babyFilename, journalName.c_str()));
+
+        // the last checkpoint that made it to the file
+        const Long64_t nEntries = oldTree->GetEntries();
+        const Long64_t nLedger  = oldLedger->GetEntries();
+        const unsigned int nLines = lines.size();
+        while (!lines.empty() && (lineEntries.back() != nEntries || lineEvents.back() > nLedger))
+        {
+            lines.pop_back();
+            lineEvents.pop_back();
+            lineEntries.pop_back();
+        }
+        if (lines.empty())
+            throw std::runtime_error(Form("[FR baby maker]: ResumeFromJournal - the %lld entries of %s are not in %s (remove it to start over)", nEntries, babyFilename, journalName.c_str()));
+        if (lines.size() != nLines)
+        {
+            const std::string tmpName = journalName + ".tmp";
+            std::ofstream rewritten(tmpName.c_str());
+            for (unsigned int iline = 0; iline < lines.size(); iline++)
+                rewritten << lines[iline] << endl;
+            rewritten.close();
+            if (!rewritten || rename(tmpName.c_str(), journalName.c_str()) != 0)
+                throw std::runtime_error(Form("[FR baby maker]: ResumeFromJournal - could not rewrite %s", journalName.c_str()));
+        }
+        nCompletedFiles = lines.size();
+        nEventsTotal    = lineEvents.back();
+
+        std::cout << "[FR baby maker]: resuming after " << nCompletedFiles << " files (" << nEventsTotal << " events, " << nEntries << " entries)" << std::endl;
+
+        // same name tables, so the indices of the old rows stay valid
+        datasetNames_ = baby_metadata::ReadNames(babyFile_, baby_metadata::kDatasets );
+        fileNames_    = baby_metadata::ReadNames(babyFile_, baby_metadata::kFilenames);
+        ReadQuantizationErrors(babyFile_);
+
+        // continue the baby of the file, with the branch addresses of the tree just booked
+        babyTree_->CopyAddresses(oldTree);
+        delete babyTree_;
+        babyTree_ = oldTree;
+
+        // the fake rates of the rows so far
+        if (!fakeRates_.empty())
+        {
+            for (Long64_t row = 0; row < nEntries; row++)
+            {
+                babyTree_->GetEntry(row);
+                UnpackBabyRow();
+                FillFakeRates();
+            }
+        }
+
+        // a new ledger of the journaled events (the old one may go past the checkpoint)
+        BookLedger();
+        ledgerTree_->CopyAddresses(oldLedger);
+        for (unsigned int ievt = 0; ievt < nEventsTotal; ievt++)
+        {
+            oldLedger->GetEntry(ievt);
+            if (ledger_is_real_data_)
+            {
+                DorkyEventIdentifier id = {static_cast<unsigned long>(ledger_run_), ledger_evt_, static_cast<unsigned long>(ledger_ls_)};
+                is_duplicate(id);
+            }
+            ledgerTree_->Fill();
+        }
+        ledgerTree_->CopyAddresses(oldLedger, /*undo=*/true);
+        delete oldLedger;
+        babyFile_->cd();
+        ledgerTree_->AutoSave("SaveSelf");
+    }
+
+    // the trees are only saved at the checkpoints of the journal
+    babyTree_->SetAutoSave(0);
+    ledgerTree_->SetAutoSave(0);
+}